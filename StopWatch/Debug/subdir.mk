@@ -4,19 +4,55 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Display.c \
+../Elapsed_Time.c \
 ../External_Interrupts.c \
+../Input_Capture.c \
+../Lap_Log.c \
+../Lap_Statistics.c \
+../RTC.c \
+../Serial_Command.c \
 ../StopWatch.c \
-../gpio.c 
+../Warm_Restart.c \
+../Watchdog.c \
+../crc8.c \
+../gpio.c \
+../spi.c \
+../uart.c 
 
 OBJS += \
+./Display.o \
+./Elapsed_Time.o \
 ./External_Interrupts.o \
+./Input_Capture.o \
+./Lap_Log.o \
+./Lap_Statistics.o \
+./RTC.o \
+./Serial_Command.o \
 ./StopWatch.o \
-./gpio.o 
+./Warm_Restart.o \
+./Watchdog.o \
+./crc8.o \
+./gpio.o \
+./spi.o \
+./uart.o 
 
 C_DEPS += \
+./Display.d \
+./Elapsed_Time.d \
 ./External_Interrupts.d \
+./Input_Capture.d \
+./Lap_Log.d \
+./Lap_Statistics.d \
+./RTC.d \
+./Serial_Command.d \
 ./StopWatch.d \
-./gpio.d 
+./Warm_Restart.d \
+./Watchdog.d \
+./crc8.d \
+./gpio.d \
+./spi.d \
+./uart.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
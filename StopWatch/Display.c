@@ -0,0 +1,289 @@
+/******************************************************************************
+ * Module: Display
+ * File Name: Display.c
+ * Description: Source file for The Six 7-Segments Display Frame Buffer and Refresh Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Display.h"
+
+#if (DISPLAY_BACKEND == DISPLAY_BACKEND_MAX7219)
+#include "spi.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* MAX7219 registers addresses (Upper byte of the SPI frame) */
+#define MAX7219_DIGIT0          0x01
+#define MAX7219_DECODE_MODE     0x09
+#define MAX7219_INTENSITY       0x0A
+#define MAX7219_SCAN_LIMIT      0x0B
+#define MAX7219_SHUTDOWN        0x0C
+#define MAX7219_DISPLAY_TEST    0x0F
+
+#define MAX7219_CODE_B_BLANK    0x0F    /* Digit is OFF in Code B decode mode */
+
+#else
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define DISPLAY_DIGIT_OFF       0xFF    /* Output of a blanked digit (Its 7-Segment is not enabled) */
+#endif
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+static volatile uint8_t g_Display_Digits[DISPLAY_DIGITS];      /* Frame buffer (Digit 0 is the units of seconds) */
+static volatile uint8_t g_Display_Attributes[DISPLAY_DIGITS];  /* Blink/Blank attributes of each digit */
+static volatile uint8_t g_Display_DirtyMask = 0;               /* Digits changed since the last Display_getDirtyDigits() */
+
+#if (DISPLAY_BACKEND == DISPLAY_BACKEND_MULTIPLEX)
+static uint8_t g_Display_Output[DISPLAY_DIGITS];  /* Decoder value of each digit (DISPLAY_DIGIT_OFF --> Not enabled) */
+static uint8_t g_Display_BusValue = 0xFF;      /* BCD value on the 7447 decoder bus (PC0 ... PC3) , 0xFF --> Unknown */
+#endif
+static uint8_t g_Display_BlinkCounter = 0;     /* Refresh passes (Timer0 overflows for MAX7219) in the current blink half period */
+static uint8_t g_Display_BlinkOff = 0;         /* Blinking digits are turned OFF in this half period */
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Mark digits dirty , the read-modify-write must not be split by an (ISR) that marks other digits */
+static void Display_markDirty(uint8_t digitsMask)
+{
+	uint8_t sreg = SREG;
+
+	CLEAR_BIT(SREG, I_BIT);
+	g_Display_DirtyMask |= digitsMask;
+	SREG = sreg;
+}
+
+/* Start the other half of the blink period , the blinking digits must be updated in it */
+static void Display_toggleBlink(void)
+{
+	uint8_t count;
+
+	g_Display_BlinkOff ^= 1;
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		if (g_Display_Attributes[count] & DISPLAY_ATTR_BLINK)
+		{
+			Display_markDirty(1 << count);
+		}
+	}
+}
+
+/* Value shown by a digit : Its BCD value , or blankValue if it is blanked or in the OFF blink phase */
+static uint8_t Display_outputValue(uint8_t position, uint8_t blankValue)
+{
+	uint8_t attributes = g_Display_Attributes[position];
+
+	if ((attributes & DISPLAY_ATTR_BLANK) || ((attributes & DISPLAY_ATTR_BLINK) && g_Display_BlinkOff))
+	{
+		return blankValue;
+	}
+
+	return g_Display_Digits[position];
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Configure the display pins and clear the frame buffer (All digits are zeros).
+ */
+void Display_Init(void)
+{
+	uint8_t count;
+
+#if (DISPLAY_BACKEND == DISPLAY_BACKEND_MULTIPLEX)
+	GPIO_setPortDirection(PORTA_ID, 0x3F); /* Configure (PA0 ... PA5) as O/P pins (Control of the 7 Segment) */
+
+	GPIO_setPortDirection(PORTC_ID, 0x0F); /* Configure (PC0 ... PC3) as O/P pins */
+#else
+	SPI_initMaster();
+
+	SPI_sendFrame((MAX7219_DISPLAY_TEST << 8) | 0x00);                  /* Normal operation (No display test) */
+	SPI_sendFrame((MAX7219_DECODE_MODE << 8) | DISPLAY_ALL_DIGITS);     /* Code B (BCD) decode for the six digits */
+	SPI_sendFrame((MAX7219_INTENSITY << 8) | DISPLAY_MAX7219_INTENSITY);
+	SPI_sendFrame((MAX7219_SCAN_LIMIT << 8) | (DISPLAY_DIGITS - 1));    /* Scan digits 0 ... 5 only */
+	SPI_sendFrame((MAX7219_SHUTDOWN << 8) | 0x01);                      /* Leave the shutdown mode */
+
+	/* Timer0 Normal mode , Prescaler = F_CPU/1024 (CS00=1 CS01=0 CS02=1)
+	 * Free running time base of the blinking (Its overflow flag is polled , no interrupt)
+	 */
+	TCNT0 = 0;
+	TCCR0 = (1 << CS02) | (1 << CS00);
+#endif
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		g_Display_Digits[count] = 0;
+		g_Display_Attributes[count] = DISPLAY_ATTR_NONE;
+	}
+
+	g_Display_DirtyMask = DISPLAY_ALL_DIGITS;
+}
+
+
+/*
+ * Description :
+ * Write a digit (0 ... 9) in the frame buffer , the digit is marked dirty only if it is changed.
+ */
+void Display_setDigit(uint8_t position, uint8_t value)
+{
+	if ((position >= DISPLAY_DIGITS) || (g_Display_Digits[position] == value))
+	{
+		return;
+	}
+
+	g_Display_Digits[position] = value;
+	Display_markDirty(1 << position);
+}
+
+
+/*
+ * Description :
+ * Set the attributes (Blink/Blank) of all the digits in the mask (Bit i --> Digit i).
+ */
+void Display_setAttributes(uint8_t digitsMask, uint8_t attributes)
+{
+	uint8_t count;
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		if (BIT_IS_SET(digitsMask, count) && (g_Display_Attributes[count] != attributes))
+		{
+			g_Display_Attributes[count] = attributes;
+			Display_markDirty(1 << count);
+		}
+	}
+}
+
+
+/*
+ * Description :
+ * Return the dirty digits mask (Bit i --> Digit i) and clear it.
+ */
+uint8_t Display_getDirtyDigits(void)
+{
+	uint8_t sreg = SREG;
+	uint8_t dirty;
+
+	CLEAR_BIT(SREG, I_BIT);  /* Digits may be set from an (ISR) between the read and the clear */
+
+	dirty = g_Display_DirtyMask;
+	g_Display_DirtyMask = 0;
+
+	SREG = sreg;
+
+	return dirty;
+}
+
+
+#if (DISPLAY_BACKEND == DISPLAY_BACKEND_MULTIPLEX)
+
+/* Function that implement the Multiplexing Mode.
+ * Description:
+ * One 7-segment display is driven by the Microcontroller at a time and the rest are OFF.
+ * It keeps switching the displays using transistors.
+ * Only the dirty digits are decoded again from the frame buffer (Value , Blink and Blank) ,
+ * and PORTC is written only when the enabled digit differs from the value on the decoder bus.
+ */
+void Display_refresh(void)
+{
+	uint8_t count;
+	uint8_t digit;
+	uint8_t dirty;
+
+	if (++g_Display_BlinkCounter >= DISPLAY_BLINK_PASSES)
+	{
+		g_Display_BlinkCounter = 0;
+		Display_toggleBlink();
+	}
+
+	dirty = Display_getDirtyDigits();
+
+	for (count = 0; dirty != 0; count++, dirty >>= 1)
+	{
+		if (dirty & 1)
+		{
+			g_Display_Output[count] = Display_outputValue(count, DISPLAY_DIGIT_OFF);
+		}
+	}
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		digit = g_Display_Output[count];
+
+		if (digit == DISPLAY_DIGIT_OFF)
+		{
+			PORTA = 0;                   /* Keep this 7-Segment OFF */
+		}
+		else
+		{
+			if (digit != g_Display_BusValue)
+			{
+				PORTC = (PORTC & 0xF0) | digit;   /* Displaying the corresponding count on the decoder bus */
+				g_Display_BusValue = digit;
+			}
+
+			PORTA = (1 << count);        /* Enable All 7-Segments (one at a time) */
+		}
+
+		_delay_ms(4);     /* Delay between each 7-segment enable to make the Stop-Watch display looks normal */
+	}
+}
+
+#else
+
+/* Function that updates the MAX7219 from the frame buffer.
+ * Description:
+ * The MAX7219 keeps refreshing the 7-Segments by itself , so only the dirty digits
+ * (and the blinking digits when the blink phase is changed) are sent over the SPI.
+ */
+void Display_refresh(void)
+{
+	uint8_t count;
+	uint8_t value;
+	uint8_t dirty;
+
+	if (BIT_IS_SET(TIFR,TOV0))
+	{
+		TIFR = (1 << TOV0);          /* Clear the overflow flag (by writing logic one , SET_BIT would clear all the flags) */
+
+		if (++g_Display_BlinkCounter >= DISPLAY_BLINK_OVERFLOWS)
+		{
+			g_Display_BlinkCounter = 0;
+			Display_toggleBlink();   /* Blinking digits are sent again in the new blink phase */
+		}
+	}
+
+	dirty = Display_getDirtyDigits();
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		if (BIT_IS_CLEAR(dirty, count))
+		{
+			continue;
+		}
+
+		value = Display_outputValue(count, MAX7219_CODE_B_BLANK);
+
+		/* Queue is full --> Keep the digit dirty to be sent in the next call */
+		if (!SPI_sendFrame(((uint16_t)(MAX7219_DIGIT0 + count) << 8) | value))
+		{
+			Display_markDirty(1 << count);
+		}
+	}
+}
+
+#endif
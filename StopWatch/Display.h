@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Module: Display
+ * File Name: Display.h
+ * Description: Header file for The Six 7-Segments Display Frame Buffer and Refresh Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+#include "External_Interrupts.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Display backends (Selected at compile time by DISPLAY_BACKEND) */
+#define DISPLAY_BACKEND_MULTIPLEX  0       /* 7447 decoder on PC0 ... PC3 and 7-Segments enables on PA0 ... PA5 */
+#define DISPLAY_BACKEND_MAX7219    1       /* Self-refreshing MAX7219 driver on the hardware SPI */
+
+#ifndef DISPLAY_BACKEND
+#define DISPLAY_BACKEND            DISPLAY_BACKEND_MULTIPLEX
+#endif
+
+#define DISPLAY_DIGITS             6
+
+/* Mask of all the digits (One bit for each digit position) */
+#define DISPLAY_ALL_DIGITS         0x3F
+
+/* Digit attributes */
+#define DISPLAY_ATTR_NONE          0x00
+#define DISPLAY_ATTR_BLINK         0x01    /* Digit is turned ON and OFF each blink period */
+#define DISPLAY_ATTR_BLANK         0x02    /* Digit is turned OFF */
+
+/* Number of refresh passes (6 x 4ms each) in the ON or OFF half of the blink period (About 0.5 second) */
+#define DISPLAY_BLINK_PASSES       21
+
+/* Number of Timer0 overflows (F_CPU/1024/256 --> 262ms each) in the blink half period (MAX7219 backend) */
+#define DISPLAY_BLINK_OVERFLOWS    2
+
+/* MAX7219 brightness (0 ... 15) */
+#define DISPLAY_MAX7219_INTENSITY  8
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Configure the display pins and clear the frame buffer (All digits are zeros).
+ */
+void Display_Init(void);
+
+/*
+ * Description :
+ * Write a digit (0 ... 9) in the frame buffer , the digit is marked dirty only if it is changed.
+ */
+void Display_setDigit(uint8_t position, uint8_t value);
+
+/*
+ * Description :
+ * Set the attributes (Blink/Blank) of all the digits in the mask (Bit i --> Digit i).
+ */
+void Display_setAttributes(uint8_t digitsMask, uint8_t attributes);
+
+/*
+ * Description :
+ * Return the dirty digits mask (Bit i --> Digit i) and clear it.
+ * Used by Display_refresh() , so it gives the digits changed since the last refresh.
+ */
+uint8_t Display_getDirtyDigits(void);
+
+/*
+ * Description :
+ * Refresh the display from the frame buffer.
+ * Multiplex backend --> One pass over the six digits (Must be called continuously) , only the
+ *                      dirty digits are decoded again.
+ * MAX7219 backend   --> Only the dirty digits are sent over the SPI (Nothing to do if no digit changed).
+ */
+void Display_refresh(void);
+
+
+#endif /* DISPLAY_H_ */
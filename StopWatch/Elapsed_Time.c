@@ -0,0 +1,271 @@
+/******************************************************************************
+ * Module: Elapsed Time
+ * File Name: Elapsed_Time.c
+ * Description: Source file for The Fixed-Point Time Arithmetic (Single tick count , 24 hours range).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Elapsed_Time.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Division by a constant as (x * RECIPROCAL) >> SHIFT , exact for all the x in the given range
+ * (Checked exhaustively : the product always fits in 32-bit)
+ */
+#define TIME_DIV3600_RECIPROCAL  37283UL   /* x / 3600 for x < 86400 */
+#define TIME_DIV3600_SHIFT       27
+#define TIME_DIV60_RECIPROCAL    2185UL    /* x / 60 for x < 3600 */
+#define TIME_DIV60_SHIFT         17
+#define TIME_DIV10_RECIPROCAL    205UL     /* x / 10 for x < 100 */
+#define TIME_DIV10_SHIFT         11
+
+/* Timer1 ticks to time ticks : (x * scale + HALF) >> TIME_TIMER1_SCALE_SHIFT , the scale error (1/2 of 2 ^ -31) gives
+ * at most 1/32 tick for x below TIME_TIMER1_MAX_TICKS (One day at 1/8 above the nominal rate : 27 bits)
+ */
+#define TIME_TIMER1_MAX_TICKS    (1UL << 27)
+#define TIME_TIMER1_SCALE_HALF   (1UL << (TIME_TIMER1_SCALE_SHIFT - 1))
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Split three values (0 --> 99) in six BCD digits , the units digit of values[i] is digits[2 * i] */
+static void Time_valuesToBCD(const uint8_t *values, uint8_t *digits)
+{
+	uint8_t tens;
+	uint8_t count;
+
+	for (count = 0; count < 3; count++)
+	{
+		tens = (uint8_t)(((uint16_t)values[count] * TIME_DIV10_RECIPROCAL) >> TIME_DIV10_SHIFT);
+
+		digits[2 * count] = values[count] - (tens * 10);    /* Units digit */
+		digits[(2 * count) + 1] = tens;                     /* Tens digit */
+	}
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the time of the required tick count (ticks must be less than TIME_TICKS_PER_DAY).
+ */
+Time_Type Time_fromTicks(uint32_t ticks)
+{
+	Time_Type time;
+
+	time.ticks = ticks;
+
+	return time;
+}
+
+
+/*
+ * Description :
+ * Return the tick count of the time.
+ */
+uint32_t Time_toTicks(Time_Type time)
+{
+	return time.ticks;
+}
+
+
+/*
+ * Description :
+ * Return the scale of Time_fromTimer1Ticks() for a Timer1 rate of windowTicks ticks in 2 ^ TIME_TIMER1_WINDOW_SHIFT
+ * seconds (Within 1/8 of TIME_TIMER1_NOMINAL_WINDOW) , two 32-bit divisions so it is done only when the rate changes.
+ */
+uint32_t Time_timer1Scale(uint32_t windowTicks)
+{
+	/* 2 ^ 45 / window as (2 ^ 31 / window) * 2 ^ 14 + the remainder part (remainder * 2 ^ 14 fits in 32-bit) */
+	uint32_t quotient = (1UL << TIME_TIMER1_SCALE_SHIFT) / windowTicks;
+	uint32_t remainder = (1UL << TIME_TIMER1_SCALE_SHIFT) % windowTicks;
+
+	return (quotient << (TIME_TICK_SHIFT + TIME_TIMER1_WINDOW_SHIFT)) +
+			(((remainder << (TIME_TICK_SHIFT + TIME_TIMER1_WINDOW_SHIFT)) + (windowTicks / 2)) / windowTicks);
+}
+
+
+/*
+ * Description :
+ * Return the time of a Timer1 tick count (A lap measured between two Timer1 timestamps) rounded to the nearest tick
+ * (Within 1/32 tick) , scale is the reciprocal of the Timer1 rate from Time_timer1Scale() or TIME_TIMER1_SCALE().
+ * Four 16-bit multiplies (No software division , no 64-bit arithmetic) , a count of one day or more gives the last tick.
+ */
+Time_Type Time_fromTimer1Ticks(uint32_t timer1Ticks, uint32_t scale)
+{
+	uint16_t ticksHigh = (uint16_t)(timer1Ticks >> 16);
+	uint16_t ticksLow = (uint16_t)timer1Ticks;
+	uint16_t scaleHigh = (uint16_t)(scale >> 16);
+	uint16_t scaleLow = (uint16_t)scale;
+	uint32_t high;
+	uint32_t middle;
+	uint32_t low;
+	uint32_t part;
+
+	if (timer1Ticks >= TIME_TIMER1_MAX_TICKS)
+	{
+		return Time_fromTicks(TIME_TICKS_PER_DAY - 1);
+	}
+
+	/* The 59-bit product (high : low) from the four 16 x 16 partial products plus the rounding half */
+	high = (uint32_t)ticksHigh * scaleHigh;
+	low = (uint32_t)ticksLow * scaleLow;
+	middle = (uint32_t)ticksHigh * scaleLow;
+	part = (uint32_t)ticksLow * scaleHigh;
+
+	middle += part;
+	if (middle < part)
+	{
+		high += 1UL << 16;   /* Carry of the middle sum */
+	}
+
+	high += middle >> 16;
+	part = middle << 16;
+	low += part;
+	high += (low < part);
+
+	low += TIME_TIMER1_SCALE_HALF;
+	high += (low < TIME_TIMER1_SCALE_HALF);
+
+	high = (high << (32 - TIME_TIMER1_SCALE_SHIFT)) | (low >> TIME_TIMER1_SCALE_SHIFT);
+
+	if (high >= TIME_TICKS_PER_DAY)
+	{
+		high = TIME_TICKS_PER_DAY - 1;
+	}
+
+	return Time_fromTicks(high);
+}
+
+
+/*
+ * Description :
+ * Return the time of the required hours , minutes and seconds (Must be in range).
+ */
+Time_Type Time_fromHMS(const Time_HMSType *hms)
+{
+	uint32_t seconds = ((uint32_t)hms->hour * 3600) + ((uint16_t)hms->min * 60) + hms->sec;
+
+	return Time_fromTicks(seconds << TIME_TICK_SHIFT);
+}
+
+
+/*
+ * Description :
+ * Return (a + b) wrapped to the 24 hours range.
+ */
+Time_Type Time_add(Time_Type a, Time_Type b)
+{
+	a.ticks += b.ticks;
+
+	if (a.ticks >= TIME_TICKS_PER_DAY)
+	{
+		a.ticks -= TIME_TICKS_PER_DAY;   /* This case is like a Reset operation when overflow occurs in Stop-Watch timer */
+	}
+
+	return a;
+}
+
+
+/*
+ * Description :
+ * Return (a - b) wrapped to the 24 hours range.
+ */
+Time_Type Time_sub(Time_Type a, Time_Type b)
+{
+	if (a.ticks < b.ticks)
+	{
+		a.ticks += TIME_TICKS_PER_DAY;
+	}
+
+	a.ticks -= b.ticks;
+
+	return a;
+}
+
+
+/*
+ * Description :
+ * Return -1 if (a < b) , 0 if (a == b) and 1 if (a > b).
+ */
+int8_t Time_compare(Time_Type a, Time_Type b)
+{
+	if (a.ticks < b.ticks)
+	{
+		return -1;
+	}
+
+	return (a.ticks > b.ticks) ? 1 : 0;
+}
+
+
+/*
+ * Description :
+ * Convert the time to hours , minutes and seconds (Multiply by reciprocal , No software division).
+ */
+void Time_toHMS(Time_Type time, Time_HMSType *hms)
+{
+	uint32_t seconds = time.ticks >> TIME_TICK_SHIFT;
+	uint16_t remainder;
+
+	hms->hour = (uint8_t)((seconds * TIME_DIV3600_RECIPROCAL) >> TIME_DIV3600_SHIFT);
+	remainder = (uint16_t)(seconds - ((uint32_t)hms->hour * 3600));    /* Seconds in the hour (0 --> 3599) */
+
+	hms->min = (uint8_t)(((uint32_t)remainder * TIME_DIV60_RECIPROCAL) >> TIME_DIV60_SHIFT);
+	hms->sec = (uint8_t)(remainder - ((uint16_t)hms->min * 60));
+}
+
+
+/*
+ * Description :
+ * Convert the time to six BCD digits , digits[0] is the units of seconds and digits[5] is the tens of hours.
+ */
+void Time_toBCD(Time_Type time, uint8_t *digits)
+{
+	Time_HMSType hms;
+	uint8_t values[3];
+
+	Time_toHMS(time, &hms);
+
+	values[0] = hms.sec;
+	values[1] = hms.min;
+	values[2] = hms.hour;
+
+	Time_valuesToBCD(values, digits);
+}
+
+
+/*
+ * Description :
+ * Convert a lap time to six BCD digits : MM:SS and the hundredths below one hour (digits[0] is the units
+ * of hundredths) , HH:MM:SS as Time_toBCD() from one hour.
+ */
+void Time_toLapBCD(Time_Type time, uint8_t *digits)
+{
+	Time_HMSType hms;
+	uint8_t values[3];
+
+	Time_toHMS(time, &hms);
+
+	if (hms.hour == 0)
+	{
+		/* Hundredths truncated as the seconds : (fraction * 100) >> TIME_TICK_SHIFT */
+		values[0] = (uint8_t)(((time.ticks & (TIME_TICKS_PER_SECOND - 1)) * 100) >> TIME_TICK_SHIFT);
+		values[1] = hms.sec;
+		values[2] = hms.min;
+	}
+	else
+	{
+		values[0] = hms.sec;
+		values[1] = hms.min;
+		values[2] = hms.hour;
+	}
+
+	Time_valuesToBCD(values, digits);
+}
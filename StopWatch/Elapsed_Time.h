@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Module: Elapsed Time
+ * File Name: Elapsed_Time.h
+ * Description: Header file for The Fixed-Point Time Arithmetic (Single tick count , 24 hours range).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef ELAPSED_TIME_H_
+#define ELAPSED_TIME_H_
+
+#include "gpio.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Tick rate = 2 ^ TIME_TICK_SHIFT ticks per second (Resolution of the Stop Watch time , the laps and their statistics)
+ * The Timer1 Compare interrupt adds TIME_TICKS_PER_SECOND to the Stop Watch time once each second.
+ */
+#define TIME_TICK_SHIFT          10
+#define TIME_TICKS_PER_SECOND    (1UL << TIME_TICK_SHIFT)
+
+/* Timer1 ticks (F_CPU/1024) in one second , the Timer1 CTC period (OCR1A + 1) without the RTC trim */
+#define TIME_TIMER1_TICKS_PER_SECOND   978UL
+
+/* The Timer1 rate of the lap conversion is given as the Timer1 ticks in 2 ^ TIME_TIMER1_WINDOW_SHIFT seconds
+ * (1/16 tick resolution , the RTC measurement window). The nominal rate is F_CPU/1024 (976.5625 ticks per second).
+ */
+#define TIME_TIMER1_WINDOW_SHIFT       4
+#define TIME_TIMER1_NOMINAL_WINDOW     ((uint32_t)((F_CPU / 1024.0) * (1 << TIME_TIMER1_WINDOW_SHIFT) + 0.5))
+
+/* Scale of Time_fromTimer1Ticks() : round(2 ^ (TIME_TIMER1_SCALE_SHIFT + TIME_TICK_SHIFT + TIME_TIMER1_WINDOW_SHIFT) / window)
+ * (Constant windows only , Time_timer1Scale() gives the same value at run time)
+ */
+#define TIME_TIMER1_SCALE_SHIFT        31
+#define TIME_TIMER1_SCALE(window)      ((uint32_t)(((1ULL << (TIME_TIMER1_SCALE_SHIFT + TIME_TICK_SHIFT + \
+                                         TIME_TIMER1_WINDOW_SHIFT)) + ((window) / 2)) / (window)))
+#define TIME_TIMER1_NOMINAL_SCALE      TIME_TIMER1_SCALE(TIME_TIMER1_NOMINAL_WINDOW)
+
+/* All the times are kept in the range (00:00:00 --> 23:59:59) and wrap after it */
+#define TIME_TICKS_PER_DAY       (86400UL << TIME_TICK_SHIFT)
+
+/* Number of BCD digits of HH:MM:SS */
+#define TIME_BCD_DIGITS          6
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Time as one tick count (Structure so it is not mixed with the other integers by mistake) */
+typedef struct
+{
+	uint32_t ticks;
+
+}Time_Type;
+
+typedef struct
+{
+	uint8_t hour;      /* 0 --> 23 */
+	uint8_t min;       /* 0 --> 59 */
+	uint8_t sec;       /* 0 --> 59 */
+
+}Time_HMSType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the time of the required tick count (ticks must be less than TIME_TICKS_PER_DAY).
+ */
+Time_Type Time_fromTicks(uint32_t ticks);
+
+/*
+ * Description :
+ * Return the tick count of the time.
+ */
+uint32_t Time_toTicks(Time_Type time);
+
+/*
+ * Description :
+ * Return the scale of Time_fromTimer1Ticks() for a Timer1 rate of windowTicks ticks in 2 ^ TIME_TIMER1_WINDOW_SHIFT
+ * seconds (Within 1/8 of TIME_TIMER1_NOMINAL_WINDOW) , two 32-bit divisions so it is done only when the rate changes.
+ */
+uint32_t Time_timer1Scale(uint32_t windowTicks);
+
+/*
+ * Description :
+ * Return the time of a Timer1 tick count (A lap measured between two Timer1 timestamps) rounded to the nearest tick
+ * (Within 1/32 tick) , scale is the reciprocal of the Timer1 rate from Time_timer1Scale() or TIME_TIMER1_SCALE().
+ * Four 16-bit multiplies (No software division , no 64-bit arithmetic) , a count of one day or more gives the last tick.
+ */
+Time_Type Time_fromTimer1Ticks(uint32_t timer1Ticks, uint32_t scale);
+
+/*
+ * Description :
+ * Return the time of the required hours , minutes and seconds (Must be in range).
+ */
+Time_Type Time_fromHMS(const Time_HMSType *hms);
+
+/*
+ * Description :
+ * Return (a + b) wrapped to the 24 hours range.
+ */
+Time_Type Time_add(Time_Type a, Time_Type b);
+
+/*
+ * Description :
+ * Return (a - b) wrapped to the 24 hours range.
+ */
+Time_Type Time_sub(Time_Type a, Time_Type b);
+
+/*
+ * Description :
+ * Return -1 if (a < b) , 0 if (a == b) and 1 if (a > b).
+ */
+int8_t Time_compare(Time_Type a, Time_Type b);
+
+/*
+ * Description :
+ * Convert the time to hours , minutes and seconds (Multiply by reciprocal , No software division).
+ */
+void Time_toHMS(Time_Type time, Time_HMSType *hms);
+
+/*
+ * Description :
+ * Convert the time to six BCD digits , digits[0] is the units of seconds and digits[5] is the tens of hours.
+ */
+void Time_toBCD(Time_Type time, uint8_t *digits);
+
+/*
+ * Description :
+ * Convert a lap time to six BCD digits : MM:SS and the hundredths below one hour (digits[0] is the units
+ * of hundredths) , HH:MM:SS as Time_toBCD() from one hour.
+ */
+void Time_toLapBCD(Time_Type time, uint8_t *digits);
+
+
+#endif /* ELAPSED_TIME_H_ */
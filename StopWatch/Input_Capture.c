@@ -0,0 +1,203 @@
+/******************************************************************************
+ * Module: Input Capture Unit
+ * File Name: Input_Capture.c
+ * Description: Source file for The Eta32mini Timer1 Input Capture (ICP1) Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Input_Capture.h"
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+/* Timer1 ticks counted by all the completed CTC periods (Upper part of the timestamp) */
+static volatile uint32_t g_ICU_BaseTicks = 0;
+
+/* Queue of the captured timestamps (Filled by the ISR , Emptied by ICU_getCapture) */
+static volatile uint32_t g_ICU_Queue[ICU_QUEUE_SIZE];
+static volatile uint8_t g_ICU_Head = 0;
+static volatile uint8_t g_ICU_Tail = 0;
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Queue the timestamp of the edge latched in ICR1 (Interrupts are disabled) */
+static void ICU_queueCapture(void)
+{
+	uint16_t captured = ICR1;
+	uint32_t timestamp = g_ICU_BaseTicks;
+	uint8_t next = (g_ICU_Head + 1) & (ICU_QUEUE_SIZE - 1);
+
+	/* The capture happened after the CTC wrap but before the Compare A (ISR) is served
+	 * (Input Capture vector has a higher priority than Compare A vector)
+	 */
+	if (BIT_IS_SET(TIFR,OCF1A) && (captured < (OCR1A >> 1)))
+	{
+		timestamp += (uint32_t)OCR1A + 1;
+	}
+
+	/* Drop the newest capture if the queue is full (oldest gate edges are kept) */
+	if (next != g_ICU_Tail)
+	{
+		g_ICU_Queue[g_ICU_Head] = timestamp + captured;
+		g_ICU_Head = next;
+	}
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enable the Timer1 Input Capture Unit on ICP1/PD6 with the required edge.
+ */
+void ICU_Init(ICU_EdgeType edge)
+{
+	GPIO_setPinDirection(PORTD_ID, PD6, PIN_INPUT);   /* Configure ICP1/PD6 as I/P pin */
+
+	/* Configure timer control register TCCR1B:
+	 * 1. Input Capture Noise Canceler ON (ICNC1=1) to filter the light gate edges
+	 * 2. ICES1=0 for falling edge , ICES1=1 for rising edge
+	 * The CTC mode and prescaler bits set by Timer1_CTC_Init() are kept as they are.
+	 */
+	SET_BIT(TCCR1B,ICNC1);
+
+	if (edge == ICU_RISING_EDGE)
+	{
+		SET_BIT(TCCR1B,ICES1);
+	}
+	else
+	{
+		CLEAR_BIT(TCCR1B,ICES1);
+	}
+
+	/* Clear any old capture flag (by writing logic one)
+	 * TIFR is out of the SBI range , SET_BIT() would read-modify-write it and clear all the pending flags
+	 */
+	TIFR = (1 << ICF1);
+
+	SET_BIT(TIMSK,TICIE1);    /* Enable Timer1 Input Capture Interrupt */
+}
+
+
+/*
+ * Description :
+ * Extend the 16-bit Timer1 count by one CTC period (OCR1A + 1 ticks).
+ */
+void ICU_timerPeriodElapsed(void)
+{
+	g_ICU_BaseTicks += (uint32_t)OCR1A + 1;
+}
+
+
+/*
+ * Description :
+ * Return the current 32-bit Timer1 timestamp (in Timer1 ticks).
+ */
+uint32_t ICU_getTimestamp(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t count;
+	uint32_t timestamp;
+
+	CLEAR_BIT(SREG, I_BIT);   /* Read the count and base ticks as one atomic operation */
+
+	count = TCNT1;
+	timestamp = g_ICU_BaseTicks;
+
+	/* Timer1 has wrapped to zero but the Compare A (ISR) did not add the period yet */
+	if (BIT_IS_SET(TIFR,OCF1A) && (count < (OCR1A >> 1)))
+	{
+		timestamp += (uint32_t)OCR1A + 1;
+	}
+
+	SREG = sreg;              /* Restore the I-bit state */
+
+	return timestamp + count;
+}
+
+
+/*
+ * Description :
+ * Restart Timer1 from zero while the timestamps continue from the current one.
+ */
+void ICU_rebase(void)
+{
+	uint8_t sreg = SREG;
+	uint8_t flags = (1 << OCF1A);
+
+	CLEAR_BIT(SREG, I_BIT);
+
+	/* Capture that is not served yet is relative to the old count , queue it before the base is moved */
+	if (BIT_IS_SET(TIMSK,TICIE1) && BIT_IS_SET(TIFR,ICF1))
+	{
+		ICU_queueCapture();
+		flags |= (1 << ICF1);
+	}
+
+	/* Ticks of the current period (And of a wrap whose Compare A (ISR) is pending) go to the base */
+	g_ICU_BaseTicks = ICU_getTimestamp();
+
+	TCNT1 = 0;
+	TIFR = flags;             /* Drop the pending compare match (Its ticks are in the base) and the served capture */
+
+	SREG = sreg;
+}
+
+
+/*
+ * Description :
+ * Drop all the captured timestamps waiting in the queue.
+ */
+void ICU_flush(void)
+{
+	uint8_t sreg = SREG;
+
+	CLEAR_BIT(SREG, I_BIT);   /* The capture (ISR) must not add an edge between the two steps */
+
+	TIFR = (1 << ICF1);       /* Capture that is not served yet is also an old edge (Other flags are kept) */
+
+	g_ICU_Tail = g_ICU_Head;
+
+	SREG = sreg;
+}
+
+
+/*
+ * Description :
+ * Pop the oldest captured 32-bit timestamp (in Timer1 ticks) from the queue.
+ */
+uint8_t ICU_getCapture(uint32_t *timestamp)
+{
+	uint8_t sreg;
+
+	if (g_ICU_Tail == g_ICU_Head)
+	{
+		return 0;             /* Queue is empty */
+	}
+
+	sreg = SREG;
+	CLEAR_BIT(SREG, I_BIT);   /* 32-bit read and the tail update must not be split by the capture (ISR) or a flush */
+
+	*timestamp = g_ICU_Queue[g_ICU_Tail];
+	g_ICU_Tail = (g_ICU_Tail + 1) & (ICU_QUEUE_SIZE - 1);
+
+	SREG = sreg;
+
+	return 1;
+}
+
+
+/*******************************************************************************
+ *                          INTERRUPT SERVICE ROUTINES                         *
+ *******************************************************************************/
+
+/* Timer1 Input Capture (ISR) that timestamps the external gate edge on ICP1 */
+ISR(TIMER1_CAPT_vect)
+{
+	ICU_queueCapture();
+}
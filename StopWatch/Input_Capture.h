@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Module: Input Capture Unit
+ * File Name: Input_Capture.h
+ * Description: Header file for The Eta32mini Timer1 Input Capture (ICP1) Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef INPUT_CAPTURE_H_
+#define INPUT_CAPTURE_H_
+
+#include "External_Interrupts.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Number of captured timestamps that can wait in the queue (Must be a power of 2) */
+#define ICU_QUEUE_SIZE   8
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef enum
+{
+	ICU_FALLING_EDGE, ICU_RISING_EDGE
+
+}ICU_EdgeType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enable the Timer1 Input Capture Unit on ICP1/PD6 with the required edge.
+ * Timer1 keeps running in CTC mode (Mode 4, TOP = OCR1A) so this function
+ * must be called after Timer1_CTC_Init() as it only adds bits to TCCR1B/TIMSK.
+ */
+void ICU_Init(ICU_EdgeType edge);
+
+/*
+ * Description :
+ * Extend the 16-bit Timer1 count by one CTC period (OCR1A + 1 ticks).
+ * Must be called from the Timer1 Compare A (ISR) only.
+ */
+void ICU_timerPeriodElapsed(void);
+
+/*
+ * Description :
+ * Return the current 32-bit Timer1 timestamp (in Timer1 ticks).
+ */
+uint32_t ICU_getTimestamp(void);
+
+/*
+ * Description :
+ * Restart Timer1 from zero (Used by the time preset) while the timestamps continue from the current one ,
+ * so a lap across the preset keeps its length. A pending capture is queued first and a pending
+ * Compare A is dropped (Its period is already counted).
+ */
+void ICU_rebase(void);
+
+/*
+ * Description :
+ * Drop all the captured timestamps waiting in the queue (and a pending capture).
+ * Called on RESET so a gate edge before it can not end the first lap after it.
+ */
+void ICU_flush(void);
+
+/*
+ * Description :
+ * Pop the oldest captured 32-bit timestamp (in Timer1 ticks) from the queue.
+ * Return 1 if a timestamp is available and 0 if the queue is empty.
+ */
+uint8_t ICU_getCapture(uint32_t *timestamp);
+
+
+#endif /* INPUT_CAPTURE_H_ */
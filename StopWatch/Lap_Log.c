@@ -0,0 +1,644 @@
+/******************************************************************************
+ * Module: Lap Log
+ * File Name: Lap_Log.c
+ * Description: Source file for The Compressed Lap/Session Log in the internal EEPROM.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Lap_Log.h"
+#include "crc8.h"
+#include <stdint.h>
+#include <avr/eeprom.h>   /* EEPROM write needs the timed EEMWE/EEWE sequence (Done in assembly by avr-libc) */
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define LAPLOG_NO_OPEN_BLOCK       0xFFFF  /* g_LapLog_Bits value when the next lap must start a new block */
+
+/* Bytes of a lap code after the committed length (With the previous and the new partial bytes) */
+#define LAPLOG_CODE_BYTES          ((7 + LAPLOG_ESCAPE_BITS + 7) / 8)
+
+/* EEPROM writes of one lap : New block header , completed code bytes and the commit slot */
+#define LAPLOG_MAX_WRITES          (3 + LAPLOG_CODE_BYTES + LAPLOG_SLOT_SIZE + 1)
+
+/* g_LapLog_ScanStep values : 0 ... (2 * LAPLOG_BLOCKS - 1) --> Check that commit slot (block * 2 + slot) ,
+ * LAPLOG_SCAN_DECODE --> Decode the newest block , LAPLOG_SCAN_DONE --> The log is ready
+ */
+#define LAPLOG_SCAN_DECODE         (2 * LAPLOG_BLOCKS)
+#define LAPLOG_SCAN_DONE           0xFF
+
+/* EEPROM address of a block byte , of a slot byte and of a payload byte */
+#define LAPLOG_ADDRESS(block, index)   ((uint8_t *)(uintptr_t)((uint16_t)(block) * LAPLOG_BLOCK_SIZE + (index)))
+#define LAPLOG_SLOT(block, slot, index) LAPLOG_ADDRESS(block, 1 + (slot) * LAPLOG_SLOT_SIZE + (index))
+#define LAPLOG_PAYLOAD(block, index)   LAPLOG_ADDRESS(block, LAPLOG_HEADER_SIZE + (index))
+
+/* Slot byte of the length high bits : Bits 0..1 and their complement in bits 2..3 (Bits 4..7 are zero) ,
+ * a half programmed byte (Some of its zero bits still at one) or an erased byte (0xFF) is never valid
+ */
+#define LAPLOG_LENGTH_HIGH(bits)       ((uint8_t)((((bits) >> 8) & 0x03) | ((~(bits) >> 6) & 0x0C)))
+#define LAPLOG_LENGTH_HIGH_VALID(high) ((((high) & 0xF0) == 0) && ((((high) >> 2) ^ (high)) & 0x03) == 0x03)
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* EEPROM byte write waiting for its turn (The bytes are written in the order they are queued) */
+typedef struct
+{
+	uint16_t address;
+	uint8_t value;
+
+}LapLog_WriteType;
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+static uint8_t g_LapLog_Block = LAPLOG_BLOCKS - 1;     /* Newest written block */
+static uint8_t g_LapLog_Sequence = 0xFF;               /* Sequence number of the newest block */
+static uint16_t g_LapLog_Bits = LAPLOG_NO_OPEN_BLOCK;  /* Committed payload bits of the newest block */
+static uint8_t g_LapLog_Tail = 0;                      /* Committed value of its partial last payload byte */
+static uint8_t g_LapLog_Slot = 1;                      /* Slot of the committed length (The next commit uses the other) */
+static uint8_t g_LapLog_PayloadCrc = CRC8_INITIAL_VALUE; /* CRC-8 of its complete payload bytes */
+static uint8_t g_LapLog_SessionPending = 0;            /* Next lap starts a new session */
+static LapLog_ModelType g_LapLog_Model;                /* Prediction of the next lap */
+
+/* Laps waiting to be coded (Their session flag is taken when they are appended) */
+static Time_Type g_LapLog_Laps[LAPLOG_QUEUE_SIZE];
+static uint8_t g_LapLog_LapSessions[LAPLOG_QUEUE_SIZE];
+static uint8_t g_LapLog_LapHead = 0;
+static uint8_t g_LapLog_LapTail = 0;
+
+/* EEPROM writes of the lap being written (The RAM state above is already after that lap) */
+static LapLog_WriteType g_LapLog_Writes[LAPLOG_MAX_WRITES];
+static uint8_t g_LapLog_WriteCount = 0;
+static uint8_t g_LapLog_WriteNext = 0;
+static uint8_t g_LapLog_Opening = 0;                   /* New sequence number of g_LapLog_Block is not written yet */
+
+/* Block scan after the power-on (One step per LapLog_process() call) */
+static uint8_t g_LapLog_ScanStep = LAPLOG_SCAN_DONE;
+static uint8_t g_LapLog_Found = 0;                     /* A valid block is found by the scan */
+static LapLog_ReaderType g_LapLog_ScanReader;          /* Decoder of the newest block */
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Prediction state at the start of a block */
+static void LapLog_resetModel(LapLog_ModelType *model)
+{
+	model->prediction = 0;
+	model->meanResidual = LAPLOG_INITIAL_MEAN;
+	model->started = 0;
+}
+
+/* Zigzag encoding maps the small negative and positive differences from the prediction to small numbers */
+static uint32_t LapLog_residual(const LapLog_ModelType *model, uint32_t lap)
+{
+	int32_t difference = (int32_t)(lap - model->prediction);
+
+	return ((uint32_t)difference << 1) ^ (uint32_t)(difference >> 31);
+}
+
+/* Rice parameter k = log2(mean of u) */
+static uint8_t LapLog_riceParameter(const LapLog_ModelType *model)
+{
+	uint8_t k = 0;
+
+	while ((model->meanResidual >> (k + 1)) != 0)
+	{
+		k++;
+	}
+
+	return k;
+}
+
+/* Follow the lap , the first lap of a block or a session restarts the prediction from it */
+static void LapLog_updateModel(LapLog_ModelType *model, uint32_t lap, uint8_t sessionStart)
+{
+	if (!model->started || sessionStart)
+	{
+		model->prediction = lap;
+		model->started = 1;
+		return;
+	}
+
+	model->meanResidual = model->meanResidual - (model->meanResidual >> 2) + (LapLog_residual(model, lap) >> 2);
+	model->prediction += (uint32_t)((int32_t)(lap - model->prediction) >> 2);
+}
+
+/* Append count bits of value (LSB first) to the code buffer */
+static void LapLog_putBits(uint8_t *buffer, uint8_t *position, uint32_t value, uint8_t count)
+{
+	while (count--)
+	{
+		if (value & 1)
+		{
+			SET_BIT(buffer[*position >> 3], (*position & 7));
+		}
+		else
+		{
+			CLEAR_BIT(buffer[*position >> 3], (*position & 7));
+		}
+
+		value >>= 1;
+		(*position)++;
+	}
+}
+
+/* Read count bits (LSB first) of the reader block , the partial last byte is the committed one from the slot */
+static uint32_t LapLog_getBits(LapLog_ReaderType *reader, uint8_t count)
+{
+	uint32_t value = 0;
+	uint8_t data = 0;
+	uint8_t bit;
+
+	for (bit = 0; bit < count; bit++)
+	{
+		/* One EEPROM read for each payload byte */
+		if ((bit == 0) || ((reader->offset & 7) == 0))
+		{
+			if ((reader->offset >> 3) == (reader->length >> 3))
+			{
+				data = reader->tail;
+			}
+			else
+			{
+				data = eeprom_read_byte(LAPLOG_PAYLOAD(reader->block, reader->offset >> 3));
+			}
+		}
+
+		if (BIT_IS_SET(data, (reader->offset & 7)))
+		{
+			value |= (uint32_t)1 << bit;
+		}
+
+		reader->offset++;
+	}
+
+	return value;
+}
+
+/* CRC-8 of the complete payload bytes before the bit length */
+static uint8_t LapLog_payloadCrc(uint8_t block, uint16_t bits)
+{
+	uint8_t crc = CRC8_INITIAL_VALUE;
+	uint8_t count;
+
+	for (count = 0; count < (bits >> 3); count++)
+	{
+		crc = CRC8_update(crc, eeprom_read_byte(LAPLOG_PAYLOAD(block, count)));
+	}
+
+	return crc;
+}
+
+/* CRC-8 of the commit slot : Complete payload bytes , partial last byte , sequence number and length */
+static uint8_t LapLog_slotCrc(uint8_t payloadCrc, uint8_t tail, uint8_t sequence, uint16_t bits)
+{
+	uint8_t crc = CRC8_update(payloadCrc, tail);
+
+	crc = CRC8_update(crc, sequence);
+	crc = CRC8_update(crc, (uint8_t)bits);
+
+	return CRC8_update(crc, LAPLOG_LENGTH_HIGH(bits));
+}
+
+/* Check one commit slot of the block , Return 1 with its length , tail and payload CRC if it is valid */
+static uint8_t LapLog_checkSlot(uint8_t block, uint8_t slot, uint8_t sequence, uint16_t *bits, uint8_t *tail,
+		uint8_t *payloadCrc)
+{
+	uint8_t high = eeprom_read_byte(LAPLOG_SLOT(block, slot, 1));
+
+	/* Erased EEPROM , invalidated slots and slots being written have a length that can not be valid */
+	if (!LAPLOG_LENGTH_HIGH_VALID(high))
+	{
+		return 0;
+	}
+
+	*bits = eeprom_read_byte(LAPLOG_SLOT(block, slot, 0)) | ((uint16_t)(high & 0x03) << 8);
+	*tail = eeprom_read_byte(LAPLOG_SLOT(block, slot, 2));
+
+	if ((*bits == 0) || (*bits > LAPLOG_PAYLOAD_BITS))
+	{
+		return 0;
+	}
+
+	*payloadCrc = LapLog_payloadCrc(block, *bits);
+
+	return (LapLog_slotCrc(*payloadCrc, *tail, sequence, *bits) == eeprom_read_byte(LAPLOG_SLOT(block, slot, 3)));
+}
+
+/* Find the committed slot of the block , Return 1 with its sequence number , length , tail and slot if one is valid */
+static uint8_t LapLog_checkBlock(uint8_t block, uint8_t *sequence, uint16_t *bits, uint8_t *tail, uint8_t *slot)
+{
+	uint8_t count;
+	uint8_t found = 0;
+	uint16_t slotBits;
+	uint8_t slotTail;
+	uint8_t payloadCrc;
+
+	*sequence = eeprom_read_byte(LAPLOG_ADDRESS(block, 0));
+
+	for (count = 0; count < 2; count++)
+	{
+		if (LapLog_checkSlot(block, count, *sequence, &slotBits, &slotTail, &payloadCrc) &&
+				(!found || (slotBits > *bits)))
+		{
+			*bits = slotBits;
+			*tail = slotTail;
+			*slot = count;
+			found = 1;
+		}
+	}
+
+	return found;
+}
+
+/* Queue an EEPROM byte write (Written by LapLog_process()) */
+static void LapLog_queueWrite(uint8_t *address, uint8_t value)
+{
+	g_LapLog_Writes[g_LapLog_WriteCount].address = (uint16_t)(uintptr_t)address;
+	g_LapLog_Writes[g_LapLog_WriteCount].value = value;
+	g_LapLog_WriteCount++;
+}
+
+/* Start writing a new block after the newest one (Overwrites the oldest block) */
+static void LapLog_openBlock(void)
+{
+	g_LapLog_Block = (g_LapLog_Block + 1) % LAPLOG_BLOCKS;
+	g_LapLog_Sequence++;
+
+	/* New sequence number first : The old slots are no longer valid (CRC-8 detects any change of one byte)
+	 * so the old block is lost as a whole , then they are erased before its payload is rewritten
+	 */
+	LapLog_queueWrite(LAPLOG_ADDRESS(g_LapLog_Block, 0), g_LapLog_Sequence);
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, 0, 1), 0xFF);
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, 1, 1), 0xFF);
+
+	g_LapLog_Opening = 1;
+
+	g_LapLog_Bits = 0;
+	g_LapLog_Tail = 0;
+	g_LapLog_Slot = 1;
+	g_LapLog_PayloadCrc = CRC8_INITIAL_VALUE;
+	LapLog_resetModel(&g_LapLog_Model);
+}
+
+/* Write the committed length in the slot that does not hold the previous one
+ * The slot is invalid (Erased length high byte) until its last byte is written , so it is never
+ * valid with a mix of old and new bytes
+ */
+static void LapLog_commit(void)
+{
+	uint8_t slot = g_LapLog_Slot ^ 1;
+
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, slot, 1), 0xFF);
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, slot, 0), (uint8_t)g_LapLog_Bits);
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, slot, 2), g_LapLog_Tail);
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, slot, 3),
+			LapLog_slotCrc(g_LapLog_PayloadCrc, g_LapLog_Tail, g_LapLog_Sequence, g_LapLog_Bits));
+	LapLog_queueWrite(LAPLOG_SLOT(g_LapLog_Block, slot, 1), LAPLOG_LENGTH_HIGH(g_LapLog_Bits));
+
+	g_LapLog_Slot = slot;
+}
+
+/* Code a lap and queue its EEPROM writes (The oldest block is overwritten when the EEPROM is full).
+ * The completed payload bytes are written first then the new length is committed in the other slot ,
+ * so an interrupted append leaves the previous commit valid and the reader ignores the new bits.
+ */
+static void LapLog_encode(Time_Type lap, uint8_t sessionStart)
+{
+	uint32_t ticks = Time_toTicks(lap);
+	uint8_t code[LAPLOG_CODE_BYTES];
+	uint8_t position;
+	uint8_t count;
+	uint8_t escape = sessionStart;
+	uint8_t k = 0;
+	uint32_t residual = 0;
+
+	g_LapLog_WriteCount = 0;
+	g_LapLog_WriteNext = 0;
+
+	if (!escape && (g_LapLog_Bits != LAPLOG_NO_OPEN_BLOCK))
+	{
+		residual = LapLog_residual(&g_LapLog_Model, ticks);
+		k = LapLog_riceParameter(&g_LapLog_Model);
+		escape = ((residual >> k) >= LAPLOG_ESCAPE_ONES);
+	}
+
+	if ((g_LapLog_Bits == LAPLOG_NO_OPEN_BLOCK) ||
+		(g_LapLog_Bits + (escape ? LAPLOG_ESCAPE_BITS : (residual >> k) + 1 + k) > LAPLOG_PAYLOAD_BITS))
+	{
+		LapLog_openBlock();
+		escape = 1;                /* First lap of a block is not a difference */
+	}
+
+	code[0] = g_LapLog_Tail;
+	position = g_LapLog_Bits & 7;
+
+	if (escape)
+	{
+		LapLog_putBits(code, &position, (1 << LAPLOG_ESCAPE_ONES) - 1, LAPLOG_ESCAPE_ONES);
+		LapLog_putBits(code, &position, sessionStart, 1);
+		LapLog_putBits(code, &position, ticks, 32);
+	}
+	else
+	{
+		LapLog_putBits(code, &position, (1 << (residual >> k)) - 1, (residual >> k) + 1);  /* q ones and a zero */
+		LapLog_putBits(code, &position, residual, k);
+	}
+
+	/* Completed code bytes (Starting with the previous partial byte) , the new partial byte is only kept in the slot */
+	for (count = 0; count < (position >> 3); count++)
+	{
+		LapLog_queueWrite(LAPLOG_PAYLOAD(g_LapLog_Block, (g_LapLog_Bits >> 3) + count), code[count]);
+		g_LapLog_PayloadCrc = CRC8_update(g_LapLog_PayloadCrc, code[count]);
+	}
+
+	g_LapLog_Bits = (g_LapLog_Bits & ~7) + position;
+	g_LapLog_Tail = (position & 7) ? (code[position >> 3] & ((1 << (position & 7)) - 1)) : 0;  /* Without the unused bits */
+
+	LapLog_commit();
+
+	LapLog_updateModel(&g_LapLog_Model, ticks, sessionStart);
+}
+
+
+/* One step of the power-on scan : Check one commit slot , then decode LAPLOG_SCAN_BITS of the newest block */
+static void LapLog_scan(void)
+{
+	uint8_t block = g_LapLog_ScanStep >> 1;
+	uint8_t slot = g_LapLog_ScanStep & 1;
+	uint8_t sequence;
+	uint16_t bits;
+	uint8_t tail;
+	uint8_t payloadCrc;
+	uint16_t end;
+	Time_Type lap;
+	uint8_t sessionStart;
+
+	if (g_LapLog_ScanStep < LAPLOG_SCAN_DECODE)
+	{
+		sequence = eeprom_read_byte(LAPLOG_ADDRESS(block, 0));
+
+		/* Newer block has a bigger sequence number (Serial number arithmetic as it wraps after 255) ,
+		 * in the same block the longer valid length is the last commit
+		 */
+		if (LapLog_checkSlot(block, slot, sequence, &bits, &tail, &payloadCrc) &&
+				(!g_LapLog_Found || ((int8_t)(sequence - g_LapLog_Sequence) > 0) ||
+				((block == g_LapLog_Block) && (bits > g_LapLog_Bits))))
+		{
+			g_LapLog_Block = block;
+			g_LapLog_Sequence = sequence;
+			g_LapLog_Bits = bits;
+			g_LapLog_Tail = tail;
+			g_LapLog_Slot = slot;
+			g_LapLog_PayloadCrc = payloadCrc;
+			g_LapLog_Found = 1;
+		}
+
+		g_LapLog_ScanStep++;
+
+		if ((g_LapLog_ScanStep == LAPLOG_SCAN_DECODE) && g_LapLog_Found)
+		{
+			/* Decode the newest block to continue its prediction */
+			g_LapLog_ScanReader.block = g_LapLog_Block;
+			g_LapLog_ScanReader.blocksLeft = 0;
+			g_LapLog_ScanReader.offset = 0;
+			g_LapLog_ScanReader.length = g_LapLog_Bits;
+			g_LapLog_ScanReader.tail = g_LapLog_Tail;
+			LapLog_resetModel(&g_LapLog_ScanReader.model);
+		}
+		else if (g_LapLog_ScanStep == LAPLOG_SCAN_DECODE)
+		{
+			g_LapLog_ScanStep = LAPLOG_SCAN_DONE;   /* Empty log --> The first lap opens a block */
+		}
+
+		return;
+	}
+
+	end = g_LapLog_ScanReader.offset + LAPLOG_SCAN_BITS;
+
+	do
+	{
+		if (!LapLog_readNext(&g_LapLog_ScanReader, &lap, &sessionStart))
+		{
+			g_LapLog_Model = g_LapLog_ScanReader.model;
+			g_LapLog_ScanStep = LAPLOG_SCAN_DONE;
+			return;
+		}
+
+	}while (g_LapLog_ScanReader.offset < end);
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start the scan of the EEPROM for the newest valid block , the next laps are appended to it.
+ * The blocks are checked and the newest one is decoded by the next LapLog_process() calls
+ * (The power-on is not delayed by the scan , the laps appended meanwhile wait in the queue).
+ */
+void LapLog_Init(void)
+{
+	g_LapLog_Block = LAPLOG_BLOCKS - 1;
+	g_LapLog_Sequence = 0xFF;
+	g_LapLog_Bits = LAPLOG_NO_OPEN_BLOCK;
+	g_LapLog_SessionPending = 0;
+	g_LapLog_LapHead = 0;
+	g_LapLog_LapTail = 0;
+	g_LapLog_WriteCount = 0;
+	g_LapLog_WriteNext = 0;
+	g_LapLog_Opening = 0;
+	g_LapLog_Found = 0;
+	g_LapLog_ScanStep = 0;
+}
+
+
+/*
+ * Description :
+ * Mark the next lap as the first lap of a new session.
+ */
+void LapLog_startSession(void)
+{
+	g_LapLog_SessionPending = 1;
+}
+
+
+/*
+ * Description :
+ * Queue a lap for the log (Written by the next LapLog_process() calls).
+ * A lap that finds the queue full is not logged , the session start it carries goes to the next lap.
+ */
+void LapLog_append(Time_Type lap)
+{
+	uint8_t next = (g_LapLog_LapHead + 1) & (LAPLOG_QUEUE_SIZE - 1);
+
+	if (next == g_LapLog_LapTail)
+	{
+		return;                    /* Queue full , the laps come faster than the EEPROM writes them */
+	}
+
+	g_LapLog_Laps[g_LapLog_LapHead] = lap;
+	g_LapLog_LapSessions[g_LapLog_LapHead] = g_LapLog_SessionPending;
+	g_LapLog_LapHead = next;
+	g_LapLog_SessionPending = 0;
+}
+
+
+/*
+ * Description :
+ * Called once per main loop pass : One step of the power-on scan or the write of one EEPROM byte.
+ * The EEPROM writes a byte in 8.5ms while the program runs , a byte is only written when the previous
+ * write is finished so the call never waits for the EEPROM (Bytes that already hold their value are skipped).
+ * Return 1 while the scan , queued laps or writes are left.
+ */
+uint8_t LapLog_process(void)
+{
+	LapLog_WriteType *write;
+
+	if (g_LapLog_ScanStep != LAPLOG_SCAN_DONE)
+	{
+		LapLog_scan();
+		return 1;
+	}
+
+	while (1)
+	{
+		if (g_LapLog_WriteNext == g_LapLog_WriteCount)
+		{
+			if (g_LapLog_LapTail == g_LapLog_LapHead)
+			{
+				return 0;
+			}
+
+			LapLog_encode(g_LapLog_Laps[g_LapLog_LapTail], g_LapLog_LapSessions[g_LapLog_LapTail]);
+			g_LapLog_LapTail = (g_LapLog_LapTail + 1) & (LAPLOG_QUEUE_SIZE - 1);
+		}
+
+		if (!eeprom_is_ready())
+		{
+			return 1;
+		}
+
+		write = &g_LapLog_Writes[g_LapLog_WriteNext];
+		g_LapLog_WriteNext++;
+		g_LapLog_Opening = 0;          /* Sequence number of a new block is always the first write */
+
+		if (eeprom_read_byte((uint8_t *)(uintptr_t)write->address) != write->value)
+		{
+			eeprom_write_byte((uint8_t *)(uintptr_t)write->address, write->value);
+			return 1;
+		}
+	}
+}
+
+
+/*
+ * Description :
+ * Return 1 when the power-on scan is finished (The log can be read).
+ */
+uint8_t LapLog_isReady(void)
+{
+	return (g_LapLog_ScanStep == LAPLOG_SCAN_DONE);
+}
+
+
+/*
+ * Description :
+ * Start reading the log from its oldest block.
+ */
+void LapLog_openReader(LapLog_ReaderType *reader)
+{
+	/* First visited block is the one after the newest in the EEPROM (A new block may still have its old data) */
+	reader->block = g_LapLog_Opening ? ((g_LapLog_Block + LAPLOG_BLOCKS - 1) % LAPLOG_BLOCKS) : g_LapLog_Block;
+	reader->blocksLeft = LAPLOG_BLOCKS;
+	reader->offset = 0;
+	reader->length = 0;
+	reader->tail = 0;
+	LapLog_resetModel(&reader->model);
+}
+
+
+/*
+ * Description :
+ * Read the next lap of the log.
+ */
+uint8_t LapLog_readNext(LapLog_ReaderType *reader, Time_Type *lap, uint8_t *sessionStart)
+{
+	uint8_t sequence;
+	uint8_t slot;
+	uint8_t ones;
+	uint8_t k;
+	uint32_t residual;
+	uint32_t ticks;
+
+	while (1)
+	{
+		/* Load the next valid block when the current one is finished */
+		while (reader->offset >= reader->length)
+		{
+			if (reader->blocksLeft == 0)
+			{
+				return 0;                     /* End of the log */
+			}
+
+			reader->block = (reader->block + 1) % LAPLOG_BLOCKS;
+			reader->blocksLeft--;
+			reader->offset = 0;
+			reader->length = 0;
+			LapLog_resetModel(&reader->model);
+
+			LapLog_checkBlock(reader->block, &sequence, &reader->length, &reader->tail, &slot);
+		}
+
+		/* Decode one lap code */
+		k = LapLog_riceParameter(&reader->model);
+		ones = 0;
+
+		while ((ones < LAPLOG_ESCAPE_ONES) && (reader->offset < reader->length) && LapLog_getBits(reader, 1))
+		{
+			ones++;
+		}
+
+		if ((ones < LAPLOG_ESCAPE_ONES) && (reader->offset >= reader->length))
+		{
+			continue;                         /* Truncated code (No zero before the end of the block) */
+		}
+
+		if (ones == LAPLOG_ESCAPE_ONES)
+		{
+			if (reader->offset + 33 > reader->length)
+			{
+				reader->offset = reader->length;  /* Truncated code --> Skip the rest of the block */
+				continue;
+			}
+
+			*sessionStart = LapLog_getBits(reader, 1);
+			ticks = LapLog_getBits(reader, 32);
+		}
+		else
+		{
+			if (reader->offset + k > reader->length)
+			{
+				reader->offset = reader->length;
+				continue;
+			}
+
+			residual = ((uint32_t)ones << k) | LapLog_getBits(reader, k);
+
+			*sessionStart = 0;
+			ticks = reader->model.prediction + (uint32_t)((residual >> 1) ^ (-(int32_t)(residual & 1)));   /* Zigzag decoding */
+		}
+
+		LapLog_updateModel(&reader->model, ticks, *sessionStart);
+		*lap = Time_fromTicks(ticks);
+
+		return 1;
+	}
+}
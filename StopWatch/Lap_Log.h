@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Module: Lap Log
+ * File Name: Lap_Log.h
+ * Description: Header file for The Compressed Lap/Session Log in the internal EEPROM.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef LAP_LOG_H_
+#define LAP_LOG_H_
+
+#include "gpio.h"
+#include "Elapsed_Time.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* The EEPROM (1 KB) is used as a ring of fixed size blocks , each block is:
+ * Byte 0      --> Block sequence number (Incremented for each new block)
+ * Bytes 1..4  --> Commit slot 0 : Payload length in bits (Low byte , high bits with their complement) ,
+ *                 Value of the last partial payload byte and CRC-8 of the committed payload ,
+ *                 the sequence number and the slot
+ * Bytes 5..8  --> Commit slot 1 (Same as slot 0)
+ * Byte 9 ...  --> Payload : Bit stream (LSB first) of the lap codes
+ *
+ * An append writes the payload bytes completed by its code after the committed length then commits the new
+ * length and partial last byte in the other slot (Shadow header) , the valid slot with the bigger length is the
+ * committed one. The slot is invalid until its length high byte is written last and the committed payload
+ * bytes are never rewritten. So a power failure in the middle of an append only loses that lap.
+ *
+ * Lap codes (Adaptive Golomb-Rice code of the difference from the predicted lap):
+ * Normal --> q ones , one zero and the k low bits of u
+ *            (u = zigzag(lap - prediction) , q = u >> k less than LAPLOG_ESCAPE_ONES)
+ * Escape --> LAPLOG_ESCAPE_ONES ones , session bit and the 32-bit lap tick count
+ *            (First lap of a block or a session , or a difference that does not fit a normal code)
+ * The prediction follows the laps (prediction += (lap - prediction) / 4) and k follows the mean of u
+ * (mean += (u - mean) / 4) , the escaped laps also update them.
+ */
+#define LAPLOG_EEPROM_SIZE         1024
+#define LAPLOG_BLOCK_SIZE          128
+#define LAPLOG_BLOCKS              (LAPLOG_EEPROM_SIZE / LAPLOG_BLOCK_SIZE)
+#define LAPLOG_SLOT_SIZE           4
+#define LAPLOG_HEADER_SIZE         (1 + 2 * LAPLOG_SLOT_SIZE)
+#define LAPLOG_PAYLOAD_SIZE        (LAPLOG_BLOCK_SIZE - LAPLOG_HEADER_SIZE)
+#define LAPLOG_PAYLOAD_BITS        ((uint16_t)LAPLOG_PAYLOAD_SIZE * 8)
+
+#define LAPLOG_ESCAPE_ONES         12
+#define LAPLOG_ESCAPE_BITS         (LAPLOG_ESCAPE_ONES + 1 + 32)
+
+/* Mean of u at the start of a block (k = 8) */
+#define LAPLOG_INITIAL_MEAN        256
+
+/* Laps waiting for their EEPROM writes (Power of 2) , a lap takes about 7 main loop passes to be written */
+#define LAPLOG_QUEUE_SIZE          8
+
+/* Payload bits decoded by one step of the power-on scan */
+#define LAPLOG_SCAN_BITS           128
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Prediction state shared by the writer and the readers (Restarted at each block) */
+typedef struct
+{
+	uint32_t prediction;    /* Predicted next lap */
+	uint32_t meanResidual;  /* Running mean of u (Selects the Rice parameter k) */
+	uint8_t started;        /* A lap of the block is coded (The first lap of a block or a session is not predicted) */
+
+}LapLog_ModelType;
+
+/* Incremental reader of the log (Oldest lap first) , only one block is checked at a time */
+typedef struct
+{
+	uint8_t block;          /* Block being read */
+	uint8_t blocksLeft;     /* Blocks not visited yet */
+	uint16_t offset;        /* Payload bit of the next lap */
+	uint16_t length;        /* Committed payload bits of the current block (0 --> Load the next block) */
+	uint8_t tail;           /* Committed value of the last partial payload byte */
+	LapLog_ModelType model;
+
+}LapLog_ReaderType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Start the scan of the EEPROM for the newest valid block , the next laps are appended to it.
+ * Blocks with no valid commit slot (Corrupted EEPROM) are ignored.
+ * The scan is done by the next LapLog_process() calls (One commit slot or LAPLOG_SCAN_BITS per call).
+ */
+void LapLog_Init(void);
+
+/*
+ * Description :
+ * Mark the next lap as the first lap of a new session (Stored with an escape code in the same block).
+ */
+void LapLog_startSession(void);
+
+/*
+ * Description :
+ * Queue a lap for the log (The oldest block is overwritten when the EEPROM is full).
+ * Non-blocking : The lap is written by the next LapLog_process() calls , it is not logged if
+ * LAPLOG_QUEUE_SIZE - 1 laps are already waiting. The queued laps are lost by a reset.
+ */
+void LapLog_append(Time_Type lap);
+
+/*
+ * Description :
+ * Called once per main loop pass : One step of the power-on scan or the write of one EEPROM byte
+ * (About 6 bytes per lap with the commit slot). Never waits for the EEPROM : A byte is only written
+ * when the previous one is finished (8.5ms).
+ * Return 1 while the scan , queued laps or writes are left.
+ */
+uint8_t LapLog_process(void);
+
+/*
+ * Description :
+ * Return 1 when the power-on scan is finished (The log can be read).
+ */
+uint8_t LapLog_isReady(void);
+
+/*
+ * Description :
+ * Start reading the log from its oldest block.
+ */
+void LapLog_openReader(LapLog_ReaderType *reader);
+
+/*
+ * Description :
+ * Read the next lap of the log.
+ * Return 1 if a lap is read (sessionStart = 1 if it is the first lap of a session)
+ * and 0 if the end of the log is reached.
+ */
+uint8_t LapLog_readNext(LapLog_ReaderType *reader, Time_Type *lap, uint8_t *sessionStart);
+
+
+#endif /* LAP_LOG_H_ */
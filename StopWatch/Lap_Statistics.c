@@ -0,0 +1,280 @@
+/******************************************************************************
+ * Module: Lap Statistics
+ * File Name: Lap_Statistics.c
+ * Description: Source file for The Rolling Lap Statistics (Best/Worst/Mean/Variance) Module.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Lap_Statistics.h"
+#include <avr/pgmspace.h>
+
+#if (LAPSTAT_WINDOW_SIZE > 8) || (LAPSTAT_WINDOW_SIZE & (LAPSTAT_WINDOW_SIZE - 1))
+#error "LAPSTAT_WINDOW_SIZE must be a power of 2 not greater than 8 (Size of g_LapStat_Reciprocal)"
+#endif
+
+#if TIME_TICKS_PER_DAY > LAPSTAT_MAX_DEVIATION
+#error "The laps of one day must be less than LAPSTAT_MAX_DEVIATION (TIME_TICK_SHIFT is too big)"
+#endif
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define LAPSTAT_INDEX_MASK       (LAPSTAT_WINDOW_SIZE - 1)
+
+/* Reciprocal of the laps count (2^32 / n rounded) used instead of the division by n
+ * Its error is at most 1/2 of 2^-32 , so |Sum| < 2^30 is divided with less than 0.63 tick of error
+ */
+#define LAPSTAT_RECIPROCAL(n)    ((uint32_t)((4294967296ULL + ((n) >> 1)) / (n)))
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+/* Reciprocals of the laps count 2 ... 8 (Count 1 needs no division) , kept in the flash */
+static const uint32_t g_LapStat_Reciprocal[] PROGMEM = {0, 0,
+		LAPSTAT_RECIPROCAL(2), LAPSTAT_RECIPROCAL(3), LAPSTAT_RECIPROCAL(4),
+		LAPSTAT_RECIPROCAL(5), LAPSTAT_RECIPROCAL(6), LAPSTAT_RECIPROCAL(7),
+		LAPSTAT_RECIPROCAL(8)};
+
+static int32_t g_LapStat_Deviations[LAPSTAT_WINDOW_SIZE];  /* Window laps (Deviation from the reference lap) */
+static uint32_t g_LapStat_Reference = 0;                   /* First lap of the session */
+static int32_t g_LapStat_Sum = 0;                          /* Sum of the window deviations */
+static uint64_t g_LapStat_SumSquares = 0;                  /* Sum of the window squared deviations */
+static uint8_t g_LapStat_Sequence = 0;                     /* Sequence number of the next lap */
+static uint8_t g_LapStat_Count = 0;                        /* Number of laps in the window */
+
+/* Monotonic queues of lap sequence numbers , the front is always the best/worst lap of the window */
+static uint8_t g_LapStat_MinQueue[LAPSTAT_WINDOW_SIZE];
+static uint8_t g_LapStat_MinFront = 0;
+static uint8_t g_LapStat_MinCount = 0;
+static uint8_t g_LapStat_MaxQueue[LAPSTAT_WINDOW_SIZE];
+static uint8_t g_LapStat_MaxFront = 0;
+static uint8_t g_LapStat_MaxCount = 0;
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Insert the newest lap in a monotonic queue after removing the expired lap from its front
+ * and the laps that can never be the best (keepSmaller = 1) or worst (keepSmaller = 0) from its back.
+ */
+static void LapStat_pushQueue(uint8_t *queue, uint8_t *front, uint8_t *count, uint8_t sequence, uint8_t keepSmaller)
+{
+	int32_t deviation = g_LapStat_Deviations[sequence & LAPSTAT_INDEX_MASK];
+	int32_t back;
+
+	if ((*count != 0) && ((uint8_t)(sequence - queue[*front]) >= LAPSTAT_WINDOW_SIZE))
+	{
+		*front = (*front + 1) & LAPSTAT_INDEX_MASK;
+		(*count)--;
+	}
+
+	while (*count != 0)
+	{
+		back = g_LapStat_Deviations[queue[(*front + *count - 1) & LAPSTAT_INDEX_MASK] & LAPSTAT_INDEX_MASK];
+
+		if (keepSmaller ? (back < deviation) : (back > deviation))
+		{
+			break;
+		}
+
+		(*count)--;
+	}
+
+	queue[(*front + *count) & LAPSTAT_INDEX_MASK] = sequence;
+	(*count)++;
+}
+
+/* Divide by the laps count (2 ... 8) as a multiplication by its reciprocal / 2^32 , rounded
+ * (The 32-bit halves are multiplied apart so nothing overflows 64-bit as the reciprocal <= 2^31)
+ */
+static uint64_t LapStat_multiplyReciprocal(uint64_t value, uint8_t count)
+{
+	uint32_t reciprocal = pgm_read_dword(&g_LapStat_Reciprocal[count]);
+
+	return ((value >> 32) * reciprocal) + ((((value & 0xFFFFFFFFUL) * reciprocal) + 0x80000000UL) >> 32);
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clear all the laps of the window to start a new session.
+ */
+void LapStat_reset(void)
+{
+	g_LapStat_Sum = 0;
+	g_LapStat_SumSquares = 0;
+	g_LapStat_Count = 0;
+	g_LapStat_MinCount = 0;
+	g_LapStat_MaxCount = 0;
+}
+
+
+/*
+ * Description :
+ * Add a new lap time to the window (The oldest lap is removed if the window is full).
+ */
+void LapStat_update(Time_Type lap)
+{
+	uint8_t index = g_LapStat_Sequence & LAPSTAT_INDEX_MASK;
+	uint32_t ticks = Time_toTicks(lap);
+	int32_t deviation;
+
+	if (g_LapStat_Count == 0)
+	{
+		g_LapStat_Reference = ticks;   /* Deviations around the first lap keep the squares small */
+	}
+
+	deviation = (int32_t)(ticks - g_LapStat_Reference);   /* Exact for any two laps of the day */
+
+	/* Remove the oldest lap from the sums if the window is full */
+	if (g_LapStat_Count == LAPSTAT_WINDOW_SIZE)
+	{
+		g_LapStat_Sum -= g_LapStat_Deviations[index];
+		g_LapStat_SumSquares -= (uint64_t)((int64_t)g_LapStat_Deviations[index] * g_LapStat_Deviations[index]);
+	}
+	else
+	{
+		g_LapStat_Count++;
+	}
+
+	g_LapStat_Deviations[index] = deviation;
+	g_LapStat_Sum += deviation;
+	g_LapStat_SumSquares += (uint64_t)((int64_t)deviation * deviation);
+
+	LapStat_pushQueue(g_LapStat_MinQueue, &g_LapStat_MinFront, &g_LapStat_MinCount, g_LapStat_Sequence, 1);
+	LapStat_pushQueue(g_LapStat_MaxQueue, &g_LapStat_MaxFront, &g_LapStat_MaxCount, g_LapStat_Sequence, 0);
+
+	g_LapStat_Sequence++;
+}
+
+
+/*
+ * Description :
+ * Return the number of laps in the window (0 ... LAPSTAT_WINDOW_SIZE).
+ */
+uint8_t LapStat_getCount(void)
+{
+	return g_LapStat_Count;
+}
+
+
+/*
+ * Description :
+ * Return the best (minimum) lap time in the window , 0 if the window is empty.
+ */
+Time_Type LapStat_getBest(void)
+{
+	if (g_LapStat_Count == 0)
+	{
+		return Time_fromTicks(0);
+	}
+
+	return Time_fromTicks(g_LapStat_Reference
+			+ g_LapStat_Deviations[g_LapStat_MinQueue[g_LapStat_MinFront] & LAPSTAT_INDEX_MASK]);
+}
+
+
+/*
+ * Description :
+ * Return the worst (maximum) lap time in the window , 0 if the window is empty.
+ */
+Time_Type LapStat_getWorst(void)
+{
+	if (g_LapStat_Count == 0)
+	{
+		return Time_fromTicks(0);
+	}
+
+	return Time_fromTicks(g_LapStat_Reference
+			+ g_LapStat_Deviations[g_LapStat_MaxQueue[g_LapStat_MaxFront] & LAPSTAT_INDEX_MASK]);
+}
+
+
+/*
+ * Description :
+ * Return the average lap time of the window , 0 if the window is empty.
+ */
+Time_Type LapStat_getMean(void)
+{
+	uint32_t magnitude;
+
+	if (g_LapStat_Count <= 1)
+	{
+		return Time_fromTicks((g_LapStat_Count == 0) ? 0 : (g_LapStat_Reference + g_LapStat_Sum));
+	}
+
+	magnitude = (g_LapStat_Sum < 0) ? -(uint32_t)g_LapStat_Sum : (uint32_t)g_LapStat_Sum;
+	magnitude = (uint32_t)LapStat_multiplyReciprocal(magnitude, g_LapStat_Count);
+
+	return Time_fromTicks((g_LapStat_Sum < 0) ? (g_LapStat_Reference - magnitude) : (g_LapStat_Reference + magnitude));
+}
+
+
+/*
+ * Description :
+ * Return the (population) variance of the lap times in the window (In squared time ticks).
+ * Variance = (n * Sum(d^2) - Sum(d)^2) / n^2 , d is the deviation of each lap.
+ */
+uint64_t LapStat_getVariance(void)
+{
+	uint64_t variance;
+
+	if (g_LapStat_Count <= 1)
+	{
+		return 0;
+	}
+
+	variance = (g_LapStat_SumSquares * g_LapStat_Count) - (uint64_t)((int64_t)g_LapStat_Sum * g_LapStat_Sum);
+
+	variance = LapStat_multiplyReciprocal(variance, g_LapStat_Count);
+	variance = LapStat_multiplyReciprocal(variance, g_LapStat_Count);
+
+	return variance;
+}
+
+
+/*
+ * Description :
+ * Return the standard deviation of the lap times in the window (Consistency measure).
+ * Integer square root (Bit by bit) of the variance , rounded to the nearest.
+ */
+Time_Type LapStat_getStdDev(void)
+{
+	uint64_t value = LapStat_getVariance();
+	uint64_t root = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+
+	while (bit > value)
+	{
+		bit >>= 2;
+	}
+
+	while (bit != 0)
+	{
+		if (value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	/* Round to the nearest : (root + 1/2)^2 = root^2 + root + 1/4 */
+	if (value > root)
+	{
+		root++;
+	}
+
+	return Time_fromTicks((uint32_t)root);
+}
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Module: Lap Statistics
+ * File Name: Lap_Statistics.h
+ * Description: Header file for The Rolling Lap Statistics (Best/Worst/Mean/Variance) Module.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef LAP_STATISTICS_H_
+#define LAP_STATISTICS_H_
+
+#include "gpio.h"
+#include "Elapsed_Time.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Number of the latest laps used by the statistics (Must be a power of 2 , Max 8 as the reciprocals table)
+ * The module uses 70 bytes of SRAM with 8 laps (The reciprocals are in the flash).
+ */
+#define LAPSTAT_WINDOW_SIZE      8
+
+/* Laps are kept as a deviation from the first lap of the session , all the laps are less than one day
+ * so a deviation is less than this value and nothing overflows (Sum < 2^30 , Squares sum x 8 < 2^60)
+ */
+#define LAPSTAT_MAX_DEVIATION    (1L << 27)
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clear all the laps of the window to start a new session.
+ */
+void LapStat_reset(void);
+
+/*
+ * Description :
+ * Add a new lap time to the window (The oldest lap is removed if the window is full).
+ * O(1) update using integer additions/multiplications only (No division).
+ */
+void LapStat_update(Time_Type lap);
+
+/*
+ * Description :
+ * Return the number of laps in the window (0 ... LAPSTAT_WINDOW_SIZE).
+ */
+uint8_t LapStat_getCount(void);
+
+/*
+ * Description :
+ * Return the best (minimum) lap time in the window , 0 if the window is empty.
+ */
+Time_Type LapStat_getBest(void);
+
+/*
+ * Description :
+ * Return the worst (maximum) lap time in the window , 0 if the window is empty.
+ */
+Time_Type LapStat_getWorst(void);
+
+/*
+ * Description :
+ * Return the average lap time of the window , 0 if the window is empty.
+ * The result is within one time tick of the exact mean for all the laps in range.
+ */
+Time_Type LapStat_getMean(void);
+
+/*
+ * Description :
+ * Return the (population) variance of the lap times in the window (In squared time ticks).
+ */
+uint64_t LapStat_getVariance(void);
+
+/*
+ * Description :
+ * Return the standard deviation of the lap times in the window (Consistency measure).
+ */
+Time_Type LapStat_getStdDev(void);
+
+
+#endif /* LAP_STATISTICS_H_ */
@@ -0,0 +1,168 @@
+/******************************************************************************
+ * Module: Real Time Clock
+ * File Name: RTC.c
+ * Description: Source file for The Eta32mini Timer2 Asynchronous (32.768 KHz Crystal) RTC Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "RTC.h"
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+/* Timer1 ticks in one measurement window = Timer1 ticks per second with RTC_WINDOW_SHIFT fraction bits */
+static volatile uint32_t g_RTC_WindowTicks = 0;
+
+static volatile uint32_t g_RTC_WindowStart = 0;   /* Timer1 timestamp at the start of the current window */
+static volatile uint8_t g_RTC_Seconds = 0;        /* Crystal seconds counted in the current window (0 --> Not started) */
+static uint8_t g_RTC_FractionAcc = 0;             /* Accumulated tick fraction of the trimmed period */
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clock Timer2 asynchronously from the 32.768 KHz watch crystal on TOSC1/TOSC2 (PC6/PC7).
+ */
+void RTC_Init(uint32_t windowTicks)
+{
+	/* Continue with the measurement kept across a warm restart , or start from the untrimmed period */
+	if ((windowTicks > RTC_NOMINAL_WINDOW_TICKS - RTC_MAX_ERROR_TICKS) &&
+		(windowTicks < RTC_NOMINAL_WINDOW_TICKS + RTC_MAX_ERROR_TICKS))
+	{
+		g_RTC_WindowTicks = windowTicks;
+	}
+	else
+	{
+		g_RTC_WindowTicks = ((uint32_t)OCR1A + 1) << RTC_WINDOW_SHIFT;
+	}
+
+	CLEAR_BIT(TIMSK,TOIE2);   /* Disable Timer2 interrupts while switching the clock source */
+
+	SET_BIT(ASSR,AS2);        /* Timer2 is clocked from the crystal on TOSC1 */
+
+	TCNT2 = 0;                /* Set timer2 initial count to zero */
+
+	/* Configure timer control register TCCR2:
+	 * 1. Normal Mode WGM20=0 WGM21=0
+	 * 2. Prescaler = F_TOSC/128 (256 Hz count --> Overflow each second)
+	      CS20=1 CS21=0 CS22=1
+	 */
+	TCCR2 = (1 << CS22) | (1 << CS20);
+
+	/* Wait until the asynchronous registers are updated */
+	while (ASSR & ((1 << TCN2UB) | (1 << TCR2UB)));
+
+	TIFR = (1 << TOV2);       /* Clear any old overflow flag (by writing logic one , Other flags are kept) */
+
+	SET_BIT(TIMSK,TOIE2);     /* Enable Timer2 Overflow Interrupt */
+}
+
+
+/*
+ * Description :
+ * Return the next Timer1 compare value (Period with the fraction applied).
+ */
+uint16_t RTC_getTrimmedCompareValue(void)
+{
+	uint16_t period = (uint16_t)(g_RTC_WindowTicks >> RTC_WINDOW_SHIFT);
+
+	/* Add one tick to the period each time the accumulated fraction reaches a whole tick */
+	g_RTC_FractionAcc += (uint8_t)(g_RTC_WindowTicks & (RTC_WINDOW_SECONDS - 1));
+
+	if (g_RTC_FractionAcc >= RTC_WINDOW_SECONDS)
+	{
+		g_RTC_FractionAcc -= RTC_WINDOW_SECONDS;
+		period++;
+	}
+
+	return period - 1;        /* CTC period is (OCR1A + 1) ticks */
+}
+
+
+/*
+ * Description :
+ * Return the last measured Timer1 ticks in one window (0 if RTC_Init() is not called).
+ */
+uint32_t RTC_getWindowTicks(void)
+{
+	uint8_t sreg = SREG;
+	uint32_t windowTicks;
+
+	CLEAR_BIT(SREG, I_BIT);   /* 32-bit read must not be split by the Timer2 (ISR) */
+	windowTicks = g_RTC_WindowTicks;
+	SREG = sreg;
+
+	return windowTicks;
+}
+
+
+/*
+ * Description :
+ * Discard the current measurement window (The Timer1 was paused or resumed).
+ */
+void RTC_restartEstimation(void)
+{
+	g_RTC_Seconds = 0;
+}
+
+
+/*
+ * Description :
+ * Return the last measured main clock error against the crystal (in ppm).
+ * Positive value --> The main clock is faster than its nominal frequency.
+ */
+int32_t RTC_getClockErrorPpm(void)
+{
+	uint8_t sreg = SREG;
+	int32_t error;
+
+	CLEAR_BIT(SREG, I_BIT);
+	error = (int32_t)(g_RTC_WindowTicks - RTC_NOMINAL_WINDOW_TICKS);
+	SREG = sreg;
+
+	return (error * 1000000L) / (int32_t)RTC_NOMINAL_WINDOW_TICKS;
+}
+
+
+/*******************************************************************************
+ *                          INTERRUPT SERVICE ROUTINES                         *
+ *******************************************************************************/
+
+/* Timer2 Overflow (ISR) that is triggered each crystal second to measure the Timer1 clock */
+ISR(TIMER2_OVF_vect)
+{
+	uint32_t timestamp = ICU_getTimestamp();
+	uint32_t measured;
+
+	/* Timer1 is paused , No valid measurement can be taken */
+	if ((TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10))) == 0)
+	{
+		g_RTC_Seconds = 0;
+		return;
+	}
+
+	if (g_RTC_Seconds == RTC_WINDOW_SECONDS)
+	{
+		measured = timestamp - g_RTC_WindowStart;
+
+		/* Reject the measurements that can not be a clock error (Missed overflow or a glitch) */
+		if ((measured > RTC_NOMINAL_WINDOW_TICKS - RTC_MAX_ERROR_TICKS) &&
+			(measured < RTC_NOMINAL_WINDOW_TICKS + RTC_MAX_ERROR_TICKS))
+		{
+			g_RTC_WindowTicks = measured;
+		}
+
+		g_RTC_Seconds = 0;
+	}
+
+	if (g_RTC_Seconds == 0)
+	{
+		g_RTC_WindowStart = timestamp;   /* Start a new window at this crystal second */
+	}
+
+	g_RTC_Seconds++;
+}
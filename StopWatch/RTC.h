@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Module: Real Time Clock
+ * File Name: RTC.h
+ * Description: Header file for The Eta32mini Timer2 Asynchronous (32.768 KHz Crystal) RTC Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef RTC_H_
+#define RTC_H_
+
+#include "Input_Capture.h"
+#include "Elapsed_Time.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Number of crystal seconds used for one clock error measurement (2 ^ RTC_WINDOW_SHIFT)
+ * The window is also the Timer1 rate unit of the lap conversion (Time_timer1Scale())
+ */
+#define RTC_WINDOW_SHIFT         TIME_TIMER1_WINDOW_SHIFT
+#define RTC_WINDOW_SECONDS       (1 << RTC_WINDOW_SHIFT)
+
+/* Expected Timer1 ticks (F_CPU/1024) in one measurement window */
+#define RTC_NOMINAL_WINDOW_TICKS ((uint32_t)((F_CPU / 1024.0) * RTC_WINDOW_SECONDS + 0.5))
+
+/* Measurements further than 1/8 (12.5%) from the nominal value are rejected */
+#define RTC_MAX_ERROR_TICKS      (RTC_NOMINAL_WINDOW_TICKS >> 3)
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Clock Timer2 asynchronously from the 32.768 KHz watch crystal on TOSC1/TOSC2 (PC6/PC7)
+ * to get an overflow interrupt each second , that is used as the reference of the estimator.
+ * windowTicks is a measurement saved before a warm restart (RTC_getWindowTicks()) , 0 or an
+ * out of range value starts from the current OCR1A period.
+ * Must be called after Timer1_CTC_Init().
+ */
+void RTC_Init(uint32_t windowTicks);
+
+/*
+ * Description :
+ * Return the next Timer1 compare value , the measured period is applied with its
+ * fraction (1/RTC_WINDOW_SECONDS of a tick) by alternating between two compare values.
+ * Must be called from the Timer1 Compare A (ISR) only.
+ */
+uint16_t RTC_getTrimmedCompareValue(void);
+
+/*
+ * Description :
+ * Return the last measured Timer1 ticks in one window (Kept across the warm restart) , the Timer1 rate
+ * that scales the laps to crystal seconds (Time_timer1Scale()).
+ */
+uint32_t RTC_getWindowTicks(void);
+
+/*
+ * Description :
+ * Discard the current measurement window (The Timer1 was paused or resumed).
+ */
+void RTC_restartEstimation(void);
+
+/*
+ * Description :
+ * Return the last measured main clock error against the crystal (in ppm).
+ */
+int32_t RTC_getClockErrorPpm(void);
+
+
+#endif /* RTC_H_ */
@@ -0,0 +1,263 @@
+/******************************************************************************
+ * Module: Serial Command
+ * File Name: Serial_Command.c
+ * Description: Source file for The Stop Watch Remote Control Protocol over the UART.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Serial_Command.h"
+#include "StopWatch.h"
+#include "Input_Capture.h"
+#include "Lap_Log.h"
+#include "Lap_Statistics.h"
+#include "uart.h"
+#include "crc8.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define SERIALCMD_LOG_LAP_SIZE     (SERIALCMD_OVERHEAD + 5)
+
+/* TX space kept free by the log export for the biggest command response */
+#define SERIALCMD_TX_RESERVE       (SERIALCMD_OVERHEAD + SERIALCMD_MAX_RESPONSE)
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+static uint16_t g_SerialCmd_LastLatency = 0;  /* Command latency (Last byte received --> Executed) in Timer1 ticks */
+static uint16_t g_SerialCmd_MaxLatency = 0;
+
+static uint8_t g_SerialCmd_Exporting = 0;     /* Log export is in progress */
+static LapLog_ReaderType g_SerialCmd_LogReader;
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Send a frame (The UART TX buffer has the space for it) */
+static void SerialCmd_sendFrame(uint8_t command, const uint8_t *payload, uint8_t length)
+{
+	uint8_t crc = CRC8_update(CRC8_update(CRC8_INITIAL_VALUE, command), length);
+	uint8_t count;
+
+	UART_sendByte(SERIALCMD_SYNC);
+	UART_sendByte(command);
+	UART_sendByte(length);
+
+	for (count = 0; count < length; count++)
+	{
+		UART_sendByte(payload[count]);
+		crc = CRC8_update(crc, payload[count]);
+	}
+
+	UART_sendByte(crc);
+}
+
+/* Write a 32-bit value in the payload (Little endian) */
+static void SerialCmd_putUint32(uint8_t *payload, uint32_t value)
+{
+	payload[0] = (uint8_t)value;
+	payload[1] = (uint8_t)(value >> 8);
+	payload[2] = (uint8_t)(value >> 16);
+	payload[3] = (uint8_t)(value >> 24);
+}
+
+/* Execute the command at the start of the RX buffer , its payload is read in place */
+static void SerialCmd_execute(uint8_t command, uint8_t length, uint16_t latency)
+{
+	uint8_t response[SERIALCMD_MAX_RESPONSE];
+	uint8_t responseLength = 1;
+
+	response[0] = SERIALCMD_OK;
+
+	switch (command)
+	{
+	case SERIALCMD_RESET:
+		resetDigits();                 /* Same as the INT0 button */
+		break;
+
+	case SERIALCMD_PAUSE:
+		StopWatch_pause();             /* Same as the INT1 button */
+		break;
+
+	case SERIALCMD_RESUME:
+		StopWatch_resume();            /* Same as the INT2 button */
+		break;
+
+	case SERIALCMD_LAP:
+		/* Lap ends when the frame is received (Its latency is in Timer1 ticks) */
+		StopWatch_lap(ICU_getTimestamp() - latency);
+		break;
+
+	case SERIALCMD_PRESET:
+		if ((length != 3) || !StopWatch_preset(UART_peek(3), UART_peek(4), UART_peek(5)))
+		{
+			response[0] = SERIALCMD_BAD_PAYLOAD;
+		}
+		break;
+
+	case SERIALCMD_STATUS:
+		StopWatch_getTime(&response[1], &response[2], &response[3]);
+		response[4] = StopWatch_isPaused();
+		response[5] = (uint8_t)g_SerialCmd_LastLatency;
+		response[6] = (uint8_t)(g_SerialCmd_LastLatency >> 8);
+		response[7] = (uint8_t)g_SerialCmd_MaxLatency;
+		response[8] = (uint8_t)(g_SerialCmd_MaxLatency >> 8);
+		responseLength = 9;
+		break;
+
+	case SERIALCMD_STATS:
+		response[1] = LapStat_getCount();
+		SerialCmd_putUint32(&response[2], Time_toTicks(LapStat_getBest()));
+		SerialCmd_putUint32(&response[6], Time_toTicks(LapStat_getWorst()));
+		SerialCmd_putUint32(&response[10], Time_toTicks(LapStat_getMean()));
+		SerialCmd_putUint32(&response[14], Time_toTicks(LapStat_getStdDev()));
+		responseLength = 18;
+		break;
+
+	case SERIALCMD_DISPLAY:
+		if ((length != 1) || !StopWatch_setDisplayPage(UART_peek(3)))
+		{
+			response[0] = SERIALCMD_BAD_PAYLOAD;
+		}
+		break;
+
+	case SERIALCMD_EXPORT_LOG:
+		if (g_SerialCmd_Exporting || !LapLog_isReady())
+		{
+			response[0] = SERIALCMD_BUSY;
+		}
+		else
+		{
+			LapLog_openReader(&g_SerialCmd_LogReader);
+			g_SerialCmd_Exporting = 1;
+		}
+		break;
+
+	default:
+		response[0] = SERIALCMD_UNKNOWN;
+		break;
+	}
+
+	SerialCmd_sendFrame(command | SERIALCMD_RESPONSE_FLAG, response, responseLength);
+}
+
+/* Send the next laps of the log while there is a space in the UART TX buffer */
+static void SerialCmd_exportLog(void)
+{
+	uint8_t payload[5];
+	uint8_t sessionStart;
+	Time_Type lap;
+
+	while (g_SerialCmd_Exporting && (UART_txFree() >= SERIALCMD_LOG_LAP_SIZE + SERIALCMD_TX_RESERVE))
+	{
+		if (LapLog_readNext(&g_SerialCmd_LogReader, &lap, &sessionStart))
+		{
+			payload[0] = sessionStart;
+			SerialCmd_putUint32(&payload[1], Time_toTicks(lap));
+
+			SerialCmd_sendFrame(SERIALCMD_LOG_LAP | SERIALCMD_RESPONSE_FLAG, payload, 5);
+		}
+		else
+		{
+			SerialCmd_sendFrame(SERIALCMD_LOG_LAP | SERIALCMD_RESPONSE_FLAG, payload, 0);   /* End of the log */
+			g_SerialCmd_Exporting = 0;
+		}
+	}
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Initialize the UART used by the commands.
+ */
+void SerialCmd_Init(void)
+{
+	UART_init();
+}
+
+
+/*
+ * Description :
+ * Parse the complete frames in place in the UART RX buffer and execute up to SERIALCMD_FRAMES_PER_CALL of them.
+ * A byte that can not start a valid frame (Wrong SYNC , length or CRC) is dropped
+ * and the parsing is restarted from the next byte. A valid frame is executed only when
+ * the UART TX buffer has the space for its response (UART_sendByte() never waits).
+ */
+void SerialCmd_process(void)
+{
+	uint8_t available;
+	uint8_t length;
+	uint8_t crc;
+	uint8_t count;
+	uint8_t frames = 0;
+	uint16_t latency;
+
+	while ((frames < SERIALCMD_FRAMES_PER_CALL) && ((available = UART_available()) != 0))
+	{
+		if (UART_peek(0) != SERIALCMD_SYNC)
+		{
+			UART_discard(1);
+			continue;
+		}
+
+		if (available < 3)
+		{
+			break;                     /* Wait for the frame header */
+		}
+
+		length = UART_peek(2);
+
+		if (length > SERIALCMD_MAX_PAYLOAD)
+		{
+			UART_discard(1);
+			continue;
+		}
+
+		if (available < length + SERIALCMD_OVERHEAD)
+		{
+			break;                     /* Wait for the rest of the frame */
+		}
+
+		crc = CRC8_INITIAL_VALUE;
+
+		for (count = 1; count < length + 3; count++)
+		{
+			crc = CRC8_update(crc, UART_peek(count));
+		}
+
+		if (crc != UART_peek(length + 3))
+		{
+			UART_discard(1);
+			continue;
+		}
+
+		if (UART_txFree() < SERIALCMD_OVERHEAD + SERIALCMD_MAX_RESPONSE)
+		{
+			break;                     /* No space for the response , the frame waits in the RX buffer */
+		}
+
+		/* Time since the last byte of the frame is received */
+		latency = (uint16_t)ICU_getTimestamp() - UART_peekTime(length + 3);
+
+		g_SerialCmd_LastLatency = latency;
+
+		if (latency > g_SerialCmd_MaxLatency)
+		{
+			g_SerialCmd_MaxLatency = latency;
+		}
+
+		SerialCmd_execute(UART_peek(1), length, latency);
+
+		UART_discard(length + SERIALCMD_OVERHEAD);
+		frames++;
+	}
+
+	SerialCmd_exportLog();
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Module: Serial Command
+ * File Name: Serial_Command.h
+ * Description: Header file for The Stop Watch Remote Control Protocol over the UART.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef SERIAL_COMMAND_H_
+#define SERIAL_COMMAND_H_
+
+#include "gpio.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Frame format (Same for the commands and the responses):
+ * | SYNC (0xA5) | CMD | LEN | PAYLOAD (LEN bytes) | CRC-8 of CMD , LEN and PAYLOAD |
+ * Each command is answered by a frame with CMD | 0x80 (Its first payload byte is the status).
+ * The lap times are tick counts of Elapsed_Time.h (TIME_TICKS_PER_SECOND ticks per second).
+ */
+#define SERIALCMD_SYNC             0xA5
+#define SERIALCMD_MAX_PAYLOAD      8
+#define SERIALCMD_OVERHEAD         4       /* SYNC , CMD , LEN and CRC bytes */
+#define SERIALCMD_RESPONSE_FLAG    0x80
+#define SERIALCMD_MAX_RESPONSE     18      /* Payload of the biggest response (STATS) */
+
+/* Frames executed by one SerialCmd_process() call (One main loop pass) , the next ones wait in the RX buffer */
+#define SERIALCMD_FRAMES_PER_CALL  2
+
+/* Commands */
+#define SERIALCMD_RESET            0x01    /* No payload */
+#define SERIALCMD_PAUSE            0x02    /* No payload */
+#define SERIALCMD_RESUME           0x03    /* No payload */
+#define SERIALCMD_LAP              0x04    /* No payload */
+#define SERIALCMD_PRESET           0x05    /* Payload : Hours , Minutes , Seconds */
+#define SERIALCMD_STATUS           0x06    /* No payload , Response : Status , Hours , Minutes , Seconds , Paused ,
+                                              Last and Max command latency (2 bytes each , Little endian ,
+                                              Timer1 ticks = 1024 / F_CPU , Exact below 67s) */
+#define SERIALCMD_EXPORT_LOG       0x07    /* No payload , Followed by one SERIALCMD_LOG_LAP frame per lap */
+#define SERIALCMD_LOG_LAP          0x08    /* Response only , Payload : Session start , Lap (4 bytes , Little endian)
+                                              An empty payload ends the log */
+#define SERIALCMD_STATS            0x09    /* No payload , Response : Status , Laps count , Best , Worst , Mean and
+                                              Standard deviation of the latest laps (4 bytes each , Little endian) */
+#define SERIALCMD_DISPLAY          0x0A    /* Payload : Display page (STOPWATCH_PAGE_TIME ... STOPWATCH_PAGE_STDDEV) */
+
+/* Status of the responses */
+#define SERIALCMD_OK               0x00
+#define SERIALCMD_BAD_PAYLOAD      0x01
+#define SERIALCMD_UNKNOWN          0x02
+#define SERIALCMD_BUSY             0x03    /* The log export is not finished or the log is not scanned yet */
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Initialize the UART used by the commands.
+ */
+void SerialCmd_Init(void);
+
+/*
+ * Description :
+ * Parse the complete frames in place in the UART RX buffer and execute up to SERIALCMD_FRAMES_PER_CALL
+ * of them , then continue the log export while there is a space in the UART TX buffer.
+ * A frame is executed only when the TX buffer has the space for its response , otherwise it stays
+ * in the RX buffer until a next call (So the UART TX is never waited for). No command waits for the
+ * EEPROM (The LAP is only queued in the lap log) , so a call is bounded whatever the received frames.
+ * The latency of a frame (Its last byte received --> Executed) is the wait for the frames before it
+ * (SERIALCMD_FRAMES_PER_CALL per main loop pass) and for the TX space , it is not bounded by one pass.
+ */
+void SerialCmd_process(void);
+
+
+#endif /* SERIAL_COMMAND_H_ */
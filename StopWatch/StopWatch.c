@@ -7,31 +7,73 @@
  * Created on: Sep 15, 2022
  *******************************************************************************/
 
-#include "gpio.h"
+#include "StopWatch.h"
 #include "External_Interrupts.h"
+#include "Input_Capture.h"
+#include "RTC.h"
+#include "Lap_Statistics.h"
+#include "Display.h"
+#include "Warm_Restart.h"
+#include "Lap_Log.h"
+#include "Serial_Command.h"
+#include "Elapsed_Time.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Set to 1 to timestamp the light gate edges on ICP1/PD6 using the Timer1 Input Capture Unit */
+#define LAP_GATE_ICU_MODE   1
+
+/* Set to 1 to trim the Timer1 compare value against the 32.768 KHz watch crystal on Timer2
+ * (The crystal must be mounted on TOSC1/TOSC2 otherwise RTC_Init() waits forever)
+ */
+#ifndef RTC_TRIM_MODE
+#define RTC_TRIM_MODE       0
+#endif
 
 /*******************************************************************************
  *                               GLOBAL VARIABLES                              *
  *******************************************************************************/
 
-static uint8_t g_Sec = 0;       /* Global variable that represent Seconds count */
-static uint8_t g_Min = 0;       /* Global variable that represent Minutes count */
-static uint8_t g_Hour = 0;      /* Global variable that represent Hours count */
+static Time_Type g_Time = {0};  /* Global variable that represent the Stop-Watch time (00:00:00 --> 23:59:59) */
 
 /* Volatile --> To Stop Compiler Optimization as (flag is set by hardware event)
  * Flag to be Set if Timer1 interrupt is triggered
  */
 volatile uint8_t g_Interrupt_Flag = 0;
 
+static Time_Type g_LastLap = {0};             /* Last lap time measured between two gate edges */
+static uint32_t g_PrevGateTimestamp = 0;      /* Timestamp of the previous gate edge (in Timer1 ticks) */
+
+/* Reciprocal of the Timer1 rate that converts the laps to seconds (Nominal F_CPU/1024 without the RTC trim) */
+static uint32_t g_LapScale = TIME_TIMER1_NOMINAL_SCALE;
+#if RTC_TRIM_MODE
+static uint32_t g_LapWindowTicks = TIME_TIMER1_NOMINAL_WINDOW;   /* RTC window of g_LapScale */
+#endif
+
+/* Flag to be Cleared on RESET so the next gate edge starts a new lap instead of ending one (Main loop only) */
+static uint8_t g_LapGateArmed = 0;
+
+/* Flag to be Set on RESET (INT0 (ISR) or serial command) so the old session is cleared by the main loop */
+static volatile uint8_t g_ResetRequest = 0;
+
+/* Page shown on the display (Time or one of the lap statistics , selected by the serial DISPLAY command) */
+static uint8_t g_DisplayPage = STOPWATCH_PAGE_TIME;
+
 
 /*******************************************************************************
  *                           FUNCTIONS PROTOTYPES                              *
  *******************************************************************************/
 
 void Timer1_CTC_Init(void);
-void StopWatch_Multiplexing_Mode(void);
 void StopWatch_TimeProcessing(void);
-void resetDigits(void);
+void StopWatch_LapProcessing(void);
+void StopWatch_ResetProcessing(void);
+void StopWatch_DisplayTime(void);
+void StopWatch_DisplayStatistic(void);
+void StopWatch_SaveState(void);
+Time_Type StopWatch_readTime(void);
 
 /*******************************************************************************
  *                                MAIN FUNCTION                                *
@@ -39,21 +81,76 @@ void resetDigits(void);
 
 int main(void)
 {
-	GPIO_setPortDirection(PORTA_ID, 0x3F); /* Configure (PA0 ... PA5) as O/P pins (Control of the 7 Segment) */
+	WarmRestart_StateType savedState;
+
+	/* Warm restart after a watchdog or brown-out reset --> Continue from the saved time */
+	uint8_t warmStart = WarmRestart_restore(WDT_getResetCause(), &savedState);
+
+	if (warmStart)
+	{
+		g_Time = savedState.time;
+	}
 
-	GPIO_setPortDirection(PORTC_ID, 0x0F); /* Configure (PC0 ... PC3) as O/P pins */
+	Display_Init();       /* Configure the 7-Segments pins and clear the frame buffer */
+
+	StopWatch_DisplayTime();
 
 	Timer1_CTC_Init();    /* Initialize TIMER1 Compare mode */
 
+	if (warmStart)
+	{
+		/* Continue the interrupted second (TCNT1 must stay below OCR1A or the compare match is missed) */
+		TCNT1 = (savedState.timerCount < OCR1A) ? savedState.timerCount : (OCR1A - 1);
+
+		if (savedState.paused)
+		{
+			StopWatch_pause();
+		}
+	}
+
+	/* Find the end of the lap log in the EEPROM (The blocks are scanned by LapLog_process() in the
+	 * main loop passes , the display is not kept dark by the scan)
+	 */
+	LapLog_Init();
+
+	if (!warmStart)
+	{
+		LapLog_startSession();
+	}
+
 	INT0_Init();          /* Initialize INT0 as RESET interrupt */
 	INT1_Init();          /* Initialize INT1 as PAUSE interrupt */
 	INT2_Init();          /* Initialize INT2 as RESUME interrupt */
 
+#if RTC_TRIM_MODE
+	/* Initialize TIMER2 from the watch crystal as the reference of Timer1 (After Timer1_CTC_Init)
+	 * A warm restart continues with the trim learned before the reset
+	 */
+	RTC_Init(warmStart ? savedState.rtcWindowTicks : 0);
+#endif
+
+#if LAP_GATE_ICU_MODE
+	ICU_Init(ICU_FALLING_EDGE);   /* Initialize ICP1 to timestamp the light gate edges (After Timer1_CTC_Init) */
+#endif
+
+	SerialCmd_Init();     /* Initialize the UART for the remote control commands */
+
 	SET_BIT(SREG, I_BIT); /* Enable global interrupts in MC by setting I-bit */
 
+	WDT_Init(WDT_520_MS); /* Reset the MC if the main loop stops feeding the watchdog */
+
 	while (1)
 	{
-		StopWatch_Multiplexing_Mode();
+		WDT_feed();
+
+		Display_refresh();
+
+		SerialCmd_process();  /* Execute up to SERIALCMD_FRAMES_PER_CALL received commands */
+
+		if (g_ResetRequest == 1)
+		{
+			StopWatch_ResetProcessing();
+		}
 
 		if (g_Interrupt_Flag == 1)
 		{
@@ -61,6 +158,17 @@ int main(void)
 
 			g_Interrupt_Flag = 0;     /* Clear flag to be Set when timer interrupt is triggered again */
 		}
+
+#if LAP_GATE_ICU_MODE
+		StopWatch_LapProcessing();
+#endif
+
+		StopWatch_SaveState();
+
+		/* One EEPROM byte per pass at the end of the pass : Its write (8.5ms) is finished before the
+		 * next pass reads the log (Display_refresh() alone takes 24ms)
+		 */
+		LapLog_process();
 	}
 
 	return 0;
@@ -74,7 +182,7 @@ void Timer1_CTC_Init(void)
 {
 	TCNT1 = 0;              /* Set timer1 initial count to zero */
 
-	OCR1A = 977;            /* Set the Compare value to 977 ( To tigger an interrupt each second ) */
+	OCR1A = TIME_TIMER1_TICKS_PER_SECOND - 1;   /* Set the Compare value to 977 ( To tigger an interrupt each second ) */
 
 	TIMSK = (1 << OCIE1A);  /* Enable Timer1 Compare A Interrupt */
 
@@ -95,67 +203,292 @@ void Timer1_CTC_Init(void)
 	TCCR1B = (1 << WGM12) | (1 << CS12) | (1 << CS10);
 }
 
-/* Function that implement the Multiplexing Mode.
+void StopWatch_TimeProcessing(void)
+{
+	/* Add one second , the time wraps to 00:00:00 after 23:59:59 (Like a Reset operation) */
+	g_Time = Time_add(g_Time, Time_fromTicks(TIME_TICKS_PER_SECOND));
+
+	StopWatch_DisplayTime();  /* Only the changed digits are marked dirty in the display frame buffer */
+}
+
+/* Function to reset all Stop-Watch Digits (Called by INT0 (ISR) , the digits are reset by the main loop) */
+void resetDigits(void)
+{
+	g_ResetRequest = 1;
+}
+
+/* Function that clears the old session from the main loop after a RESET.
  * Description:
- * One 7-segment display is driven by the Microcontroller at a time and the rest are OFF.
- * It keeps switching the displays using transistors.
+ * The lap gate and the capture queue are only used by the main loop , so a RESET can not
+ * split a capture pop or a lap (A popped pre-RESET edge never re-arms the gate).
  */
-void StopWatch_Multiplexing_Mode(void)
+void StopWatch_ResetProcessing(void)
 {
-	/* To get first digit of Seconds , Use g_Sec % 10
-	 * To get second digit of Seconds , Use g_Sec / 10
-	 * That technique is also applied on g_Min , g_Hour
-	 */
-	uint8_t timeDigits[] = {(g_Sec % 10),(g_Sec / 10),
-			                (g_Min % 10),(g_Min / 10),
-			                (g_Hour % 10),(g_Hour / 10)};      /* Array that contains the Stop-Watch digits */
+	g_ResetRequest = 0;       /* Cleared first , a RESET pressed meanwhile is processed again by the next pass */
+
+	g_Time = Time_fromTicks(0);
+
+	g_LapGateArmed = 0;       /* Next gate edge starts a new lap */
+
+	ICU_flush();              /* Gate edges queued before the RESET belong to the old session */
+
+	StopWatch_DisplayTime();
+
+	LapStat_reset();
+
+	StopWatch_DisplayStatistic();
+
+	LapLog_startSession();
+}
 
-	for(uint8_t count = 0; count < 6; count++)
+/* Function that writes all the Stop-Watch digits in the display frame buffer (Time page only) */
+void StopWatch_DisplayTime(void)
+{
+	uint8_t digits[TIME_BCD_DIGITS];
+	uint8_t count;
+
+	if (g_DisplayPage != STOPWATCH_PAGE_TIME)
 	{
+		return;
+	}
 
-		PORTA = (1 << count);        /* Enable All 7-Segments (one at a time) */
+	Time_toBCD(StopWatch_readTime(), digits);
 
-		/* First:  Clearing the display each iteration
-		 * Second: Displaying the corresponding count in the enabled 7-Segment
-		 */
-		PORTC = (PORTC & 0xF0) | timeDigits[count];
+	for (count = 0; count < TIME_BCD_DIGITS; count++)
+	{
+		Display_setDigit(count, digits[count]);
+	}
+}
 
-		_delay_ms(4);     /* Delay between each 7-segment enable to make the Stop-Watch display looks normal */
+/* Function that writes the lap statistic of the display page in the display frame buffer (Statistic pages only) */
+void StopWatch_DisplayStatistic(void)
+{
+	uint8_t digits[TIME_BCD_DIGITS];
+	uint8_t count;
+	Time_Type value;
+
+	switch (g_DisplayPage)
+	{
+	case STOPWATCH_PAGE_BEST:
+		value = LapStat_getBest();
+		break;
+	case STOPWATCH_PAGE_WORST:
+		value = LapStat_getWorst();
+		break;
+	case STOPWATCH_PAGE_MEAN:
+		value = LapStat_getMean();
+		break;
+	case STOPWATCH_PAGE_STDDEV:
+		value = LapStat_getStdDev();
+		break;
+	default:
+		return;
+	}
+
+	Time_toLapBCD(value, digits);
+
+	for (count = 0; count < TIME_BCD_DIGITS; count++)
+	{
+		Display_setDigit(count, digits[count]);
 	}
 }
 
-void StopWatch_TimeProcessing(void)
+/* Function to select the display page , returns 0 if the page is out of range (Main loop only) */
+uint8_t StopWatch_setDisplayPage(uint8_t page)
+{
+	if (page > STOPWATCH_PAGE_STDDEV)
+	{
+		return 0;
+	}
+
+	g_DisplayPage = page;
+
+	StopWatch_DisplayTime();
+	StopWatch_DisplayStatistic();
+
+	return 1;
+}
+
+/* Function that returns the Stop-Watch time (Only the main loop changes it , the RESET (ISR) sets a request) */
+Time_Type StopWatch_readTime(void)
+{
+	return g_Time;
+}
+
+/* Function that saves the Stop-Watch state for the warm restart.
+ * Description:
+ * Called each main loop pass so the time lost by a watchdog or brown-out reset
+ * is only the time since the last pass and the MC startup time.
+ */
+void StopWatch_SaveState(void)
 {
-	/* Check if Seconds exceeded the range (0 --> 59) or not */
-	if (g_Sec == 59)
+	WarmRestart_StateType state;
+	uint8_t sreg = SREG;
+
+	CLEAR_BIT(SREG, I_BIT);   /* Time and Timer1 count must be taken at the same moment */
+
+	state.time = g_Time;
+	state.paused = StopWatch_isPaused();
+	state.timerCount = TCNT1;
+	state.rtcWindowTicks = RTC_getWindowTicks();
+
+	/* Second is ended but not counted yet , restart at the end of the period to count it again */
+	if (g_Interrupt_Flag || BIT_IS_SET(TIFR,OCF1A))
 	{
-		g_Sec = 0;       /* Clear Seconds if exceeded */
-		g_Min++;         /* Increment Mintues */
+		state.timerCount = OCR1A - 1;
 	}
-	else
-		g_Sec++;         /* Increment Seconds if not exceeded */
 
-	/* Check if Mintues exceeded the range (0 --> 59) or not */
-	if (g_Min > 59)
+	SREG = sreg;
+
+	WarmRestart_save(&state);
+}
+
+/* Function that turns the captured gate timestamps into lap times.
+ * Description:
+ * Each lap is the difference between two consecutive gate edges timestamped by the
+ * Input Capture Unit, so it has the Timer1 resolution without any ISR latency or jitter.
+ */
+void StopWatch_LapProcessing(void)
+{
+	uint32_t timestamp;
+
+	while (ICU_getCapture(&timestamp))
 	{
-		g_Min = 0;      /* Clear Mintues if exceeded */
-		g_Hour++;       /* Increment Hours */
+		StopWatch_lap(timestamp);
 	}
+}
 
-	/* Check if Hours exceeded the range (0 --> 23 in one day) or not */
-	if (g_Hour > 23)
+/* Function that ends a lap at the gate edge timestamp (in Timer1 ticks) */
+void StopWatch_lap(uint32_t timestamp)
+{
+#if RTC_TRIM_MODE
+	uint32_t windowTicks;
+#endif
+
+	if (g_LapGateArmed)
 	{
-		g_Hour = 0;    /* Clear Hours if exceeded */
-		               /* This case is like a Reset operation when overflow occurs in Stop-Watch timer */
+#if RTC_TRIM_MODE
+		/* Laps in crystal seconds : The scale follows the Timer1 rate measured by the RTC (Divided only when it changes) */
+		windowTicks = RTC_getWindowTicks();
+
+		if (windowTicks != g_LapWindowTicks)
+		{
+			g_LapWindowTicks = windowTicks;
+			g_LapScale = Time_timer1Scale(windowTicks);
+		}
+#endif
+
+		/* Unsigned subtraction handles the 32-bit wrap */
+		g_LastLap = Time_fromTimer1Ticks(timestamp - g_PrevGateTimestamp, g_LapScale);
+
+		LapStat_update(g_LastLap);   /* Best , Worst , Average and Consistency of the latest laps */
+
+		StopWatch_DisplayStatistic();   /* Live statistic page (Only the changed digits are marked dirty) */
+
+		LapLog_append(g_LastLap);    /* Keep the lap in the EEPROM across the power cycles */
 	}
+
+	g_PrevGateTimestamp = timestamp;
+	g_LapGateArmed = 1;
 }
 
-/* Function to reset all Stop-Watch Digits */
-void resetDigits(void)
+/* Function to PAUSE the Stop-Watch timer (Called by INT1 (ISR) and the serial PAUSE command) */
+void StopWatch_pause(void)
+{
+	uint8_t sreg = SREG;
+
+	CLEAR_BIT(SREG, I_BIT);   /* TCCR1B read-modify-write must not be split by the other button */
+
+	/* Configure timer control register TCCR1B:
+	 * No clock source (Timer/Counter stopped)
+	      CS10=0 CS11=0 CS12=0
+	 */
+	CLEAR_BIT(TCCR1B,CS10);
+	CLEAR_BIT(TCCR1B,CS11);
+	CLEAR_BIT(TCCR1B,CS12);
+
+	RTC_restartEstimation();  /* Timer1 ticks are not counted while paused */
+
+	Display_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_BLINK);   /* Blink all digits while paused */
+
+	SREG = sreg;
+}
+
+/* Function to RESUME the Stop-Watch timer if it is paused (Called by INT2 (ISR) and the serial RESUME command) */
+void StopWatch_resume(void)
+{
+	uint8_t sreg = SREG;
+
+	CLEAR_BIT(SREG, I_BIT);
+
+	/* Configure timer control register TCCR1B:
+	 * Clock Source ON again (F_CLK/1024 (From prescaler))
+	      CS10=1 CS11=0 CS12=1
+	 */
+
+	/* Check if bit (CS10) in register (TCCR1B) is cleared or not */
+	if (BIT_IS_CLEAR(TCCR1B,CS10))
+	{
+		SET_BIT(TCCR1B,CS10);
+	}
+
+	/* Check if bit (CS12) in register (TCCR1B) is cleared or not */
+	if (BIT_IS_CLEAR(TCCR1B,CS12))
+	{
+		SET_BIT(TCCR1B,CS12);
+	}
+
+	RTC_restartEstimation();  /* Measurement window must not contain the paused time */
+
+	Display_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_NONE);
+
+	SREG = sreg;
+}
+
+/* Function that returns 1 if the Stop-Watch timer is paused and 0 otherwise */
+uint8_t StopWatch_isPaused(void)
 {
-	g_Sec = 0;
-	g_Min = 0;
-	g_Hour = 0;
+	return ((TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10))) == 0);
+}
+
+/* Function to set the Stop-Watch time (The current second starts from its beginning) */
+uint8_t StopWatch_preset(uint8_t hour, uint8_t min, uint8_t sec)
+{
+	Time_HMSType hms = {hour, min, sec};
+	uint8_t sreg;
+
+	if ((hour > 23) || (min > 59) || (sec > 59))
+	{
+		return 0;
+	}
+
+	sreg = SREG;
+	CLEAR_BIT(SREG, I_BIT);
+
+	g_Time = Time_fromHMS(&hms);
+
+	ICU_rebase();             /* TCNT1 = 0 and drop a pending compare match of the old second */
+	g_Interrupt_Flag = 0;
+
+	RTC_restartEstimation();  /* Timer1 count is changed by software */
+
+	SREG = sreg;
+
+	StopWatch_DisplayTime();
+
+	return 1;
+}
+
+/* Function to read the Stop-Watch time */
+void StopWatch_getTime(uint8_t *hour, uint8_t *min, uint8_t *sec)
+{
+	Time_HMSType hms;
+
+	Time_toHMS(StopWatch_readTime(), &hms);
+
+	*hour = hms.hour;
+	*min = hms.min;
+	*sec = hms.sec;
 }
 
 
@@ -166,4 +499,10 @@ void resetDigits(void)
 ISR(TIMER1_COMPA_vect)
 {
 	g_Interrupt_Flag = 1;    /* Set this global interrupt flag as an indication of Timer1 interrupt */
+
+	ICU_timerPeriodElapsed(); /* Extend the Timer1 count used by the capture timestamps (Uses the ended period) */
+
+#if RTC_TRIM_MODE
+	OCR1A = RTC_getTrimmedCompareValue();   /* Next period measured against the crystal */
+#endif
 }
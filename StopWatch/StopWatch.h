@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Module: StopWatch Main file
+ * File Name: StopWatch.h
+ * Description: Header file for The Stop Watch state transitions (Used by the buttons and the serial commands).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STOPWATCH_H_
+#define STOPWATCH_H_
+
+#include "gpio.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Display pages (The lap statistics are shown as MM:SS and hundredths below one hour , HH:MM:SS from it) */
+#define STOPWATCH_PAGE_TIME      0       /* Stop-Watch time (Default) */
+#define STOPWATCH_PAGE_BEST      1       /* Best lap of the latest laps */
+#define STOPWATCH_PAGE_WORST     2       /* Worst lap of the latest laps */
+#define STOPWATCH_PAGE_MEAN      3       /* Average lap of the latest laps */
+#define STOPWATCH_PAGE_STDDEV    4       /* Standard deviation (Consistency) of the latest laps */
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/* Function to reset all Stop-Watch Digits (Old session is cleared later by the main loop) */
+void resetDigits(void);
+
+/* Function to PAUSE the Stop-Watch timer (Timer1 clock is stopped) */
+void StopWatch_pause(void);
+
+/* Function to RESUME the Stop-Watch timer if it is paused */
+void StopWatch_resume(void);
+
+/* Function that returns 1 if the Stop-Watch timer is paused and 0 otherwise */
+uint8_t StopWatch_isPaused(void);
+
+/* Function to set the Stop-Watch time , returns 0 if the time is out of range (Hours 0 --> 23 , Minutes/Seconds 0 --> 59) */
+uint8_t StopWatch_preset(uint8_t hour, uint8_t min, uint8_t sec);
+
+/* Function to read the Stop-Watch time */
+void StopWatch_getTime(uint8_t *hour, uint8_t *min, uint8_t *sec);
+
+/* Function that ends a lap at the gate edge timestamp (in Timer1 ticks) */
+void StopWatch_lap(uint32_t timestamp);
+
+/* Function to select the display page , returns 0 if the page is out of range (The statistics follow each lap) */
+uint8_t StopWatch_setDisplayPage(uint8_t page);
+
+
+#endif /* STOPWATCH_H_ */
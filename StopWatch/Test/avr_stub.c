@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: avr_stub.c
+ * Description: Storage of the stub ATmega32 I/O registers used by the host tests.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "avr_stub.h"
+#include <util/delay.h>
+
+volatile uint8_t SREG, MCUCR, MCUCSR, GICR, GIFR, TIMSK, TIFR = STUB_TIFR_MARKER;
+volatile uint8_t PORTA, PORTB, PORTC, PORTD, DDRA, DDRB, DDRC, DDRD, PINA, PINB, PINC, PIND;
+volatile uint8_t TCCR0, TCNT0, TCCR1A, TCCR1B, TCCR2, TCNT2, OCR2, ASSR;
+volatile uint16_t TCNT1, OCR1A, OCR1B, ICR1;
+volatile uint8_t SPCR, SPSR, SPDR;
+volatile uint8_t UCSRA, UCSRB, UCSRC, UBRRL, UBRRH, UDR;
+volatile uint8_t WDTCR;
+
+double g_Stub_DelayMs = 0;
+void (*g_Stub_DelayHook)(void) = 0;
+void (*g_Stub_WdtResetHook)(void) = 0;
+
+static uint8_t g_Stub_TifrFlags = 0;
+
+void Stub_syncTifr(void)
+{
+	if (!(TIFR & STUB_TIFR_MARKER))
+	{
+		g_Stub_TifrFlags &= ~TIFR;
+	}
+
+	TIFR = g_Stub_TifrFlags | STUB_TIFR_MARKER;
+}
+
+void Stub_setFlag(uint8_t bit)
+{
+	Stub_syncTifr();
+	g_Stub_TifrFlags |= (1 << bit);
+	TIFR = g_Stub_TifrFlags | STUB_TIFR_MARKER;
+}
+
+void Stub_clearFlag(uint8_t bit)
+{
+	Stub_syncTifr();
+	g_Stub_TifrFlags &= ~(1 << bit);
+	TIFR = g_Stub_TifrFlags | STUB_TIFR_MARKER;
+}
+
+uint8_t Stub_isFlagSet(uint8_t bit)
+{
+	Stub_syncTifr();
+	return (g_Stub_TifrFlags >> bit) & 1;
+}
@@ -0,0 +1,32 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: avr_stub.h
+ * Description: Hardware side of the stub ATmega32 registers used by the host tests.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef AVR_STUB_H_
+#define AVR_STUB_H_
+
+#include <avr/io.h>
+
+/* TIFR flags are cleared by writing logic one , a plain variable can not do that so the
+ * stub keeps the real flags apart and puts the unused OCF2 bit in TIFR as a marker :
+ * A write by the code under test replaces the marker and its ones are the cleared flags.
+ * The code must clear its flags with one write (TIFR = (1 << FLAG)) as on the real MC ,
+ * a read-modify-write (SET_BIT) keeps the marker and clears nothing here (On the MC it clears all the flags).
+ */
+#define STUB_TIFR_MARKER   0x80
+
+/* Apply the last write of the code to the flags and show the flags in TIFR again */
+void Stub_syncTifr(void);
+
+/* Set or clear a TIFR flag from the hardware side */
+void Stub_setFlag(uint8_t bit);
+void Stub_clearFlag(uint8_t bit);
+
+/* Return 1 if the TIFR flag is set (After applying the code writes) */
+uint8_t Stub_isFlagSet(uint8_t bit);
+
+#endif /* AVR_STUB_H_ */
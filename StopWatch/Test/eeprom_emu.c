@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: eeprom_emu.c
+ * Description: ATmega32 internal EEPROM (1 KB) emulator behind the avr-libc eeprom functions.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eeprom_emu.h"
+
+uint8_t g_EepromEmu_Memory[EEPROM_EMU_SIZE] = {[0 ... E2END] = 0xFF};
+unsigned long g_EepromEmu_Writes = 0;
+unsigned long g_EepromEmu_WritesToFail = 0;
+uint8_t g_EepromEmu_FailMask = 0xFF;
+void (*g_EepromEmu_FailHook)(void) = NULL;
+unsigned long g_EepromEmu_Reads = 0;
+unsigned int g_EepromEmu_WriteTicks = 0;
+unsigned long g_EepromEmu_Waits = 0;
+void (*g_EepromEmu_WaitHook)(void) = NULL;
+
+static unsigned int g_EepromEmu_BusyTicks = 0;   /* Ticks left of the write in progress */
+
+/* EEPROM address of the avr-libc pointer argument (Out of range --> Test bug) */
+static uint16_t EepromEmu_address(const uint8_t *address)
+{
+	uintptr_t index = (uintptr_t)address;
+
+	if (index > E2END)
+	{
+		printf("EEPROM address 0x%lx out of range\n", (unsigned long)index);
+		abort();
+	}
+
+	return (uint16_t)index;
+}
+
+/* Busy wait of avr-libc for the end of the write in progress */
+static void EepromEmu_wait(void)
+{
+	if (g_EepromEmu_BusyTicks == 0)
+	{
+		return;
+	}
+
+	g_EepromEmu_Waits++;
+
+	while ((g_EepromEmu_BusyTicks != 0) && (g_EepromEmu_WaitHook != NULL))
+	{
+		g_EepromEmu_WaitHook();
+	}
+
+	g_EepromEmu_BusyTicks = 0;
+}
+
+void EepromEmu_erase(void)
+{
+	memset(g_EepromEmu_Memory, 0xFF, sizeof(g_EepromEmu_Memory));
+	g_EepromEmu_Writes = 0;
+	g_EepromEmu_BusyTicks = 0;
+}
+
+void EepromEmu_tick(void)
+{
+	if (g_EepromEmu_BusyTicks != 0)
+	{
+		g_EepromEmu_BusyTicks--;
+	}
+}
+
+uint8_t eeprom_is_ready(void)
+{
+	return (g_EepromEmu_BusyTicks == 0);
+}
+
+uint8_t eeprom_read_byte(const uint8_t *address)
+{
+	EepromEmu_wait();
+	g_EepromEmu_Reads++;
+
+	return g_EepromEmu_Memory[EepromEmu_address(address)];
+}
+
+void eeprom_write_byte(uint8_t *address, uint8_t value)
+{
+	EepromEmu_wait();
+
+	if (g_EepromEmu_WritesToFail && (--g_EepromEmu_WritesToFail == 0))
+	{
+		g_EepromEmu_Memory[EepromEmu_address(address)] = value | g_EepromEmu_FailMask;
+
+		if (g_EepromEmu_FailHook != NULL)
+		{
+			g_EepromEmu_FailHook();
+		}
+
+		printf("EEPROM power failure hook returned\n");
+		abort();
+	}
+
+	g_EepromEmu_Memory[EepromEmu_address(address)] = value;
+	g_EepromEmu_Writes++;
+	g_EepromEmu_BusyTicks = g_EepromEmu_WriteTicks;
+}
+
+void eeprom_update_byte(uint8_t *address, uint8_t value)
+{
+	if (eeprom_read_byte(address) != value)
+	{
+		eeprom_write_byte(address, value);
+	}
+}
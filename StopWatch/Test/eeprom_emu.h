@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: eeprom_emu.h
+ * Description: ATmega32 internal EEPROM (1 KB) emulator behind the avr-libc eeprom functions.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef EEPROM_EMU_H_
+#define EEPROM_EMU_H_
+
+#include <avr/eeprom.h>
+
+#define EEPROM_EMU_SIZE   (E2END + 1)
+
+/* EEPROM content (Erased bytes are 0xFF) */
+extern uint8_t g_EepromEmu_Memory[EEPROM_EMU_SIZE];
+
+/* Bytes written (Each write is an EEPROM erase/write cycle of about 8.5ms) */
+extern unsigned long g_EepromEmu_Writes;
+
+/* Bytes read */
+extern unsigned long g_EepromEmu_Reads;
+
+/* Write time : Each write keeps the EEPROM busy for g_EepromEmu_WriteTicks calls of EepromEmu_tick()
+ * (0 --> Instant write). A read or a write while the EEPROM is busy is counted in g_EepromEmu_Waits
+ * (avr-libc waits for EEWE) and calls g_EepromEmu_WaitHook until the write is finished (The hook must
+ * run the time , e.g. the test ticks , or the wait ends at once if there is no hook)
+ */
+extern unsigned int g_EepromEmu_WriteTicks;
+extern unsigned long g_EepromEmu_Waits;
+extern void (*g_EepromEmu_WaitHook)(void);
+
+/* Power failure injection : The write number g_EepromEmu_WritesToFail (Counted down , 0 --> Never) is
+ * interrupted after the erase , the byte gets (value | g_EepromEmu_FailMask) as the bits of the mask are
+ * not programmed yet (0xFF --> Erased byte) , then g_EepromEmu_FailHook is called instead of returning
+ * (It must not return , e.g. longjmp to the next power-on)
+ */
+extern unsigned long g_EepromEmu_WritesToFail;
+extern uint8_t g_EepromEmu_FailMask;
+extern void (*g_EepromEmu_FailHook)(void);
+
+/* Erase all the EEPROM and clear the writes count */
+void EepromEmu_erase(void);
+
+/* One test tick of the write in progress */
+void EepromEmu_tick(void);
+
+#endif /* EEPROM_EMU_H_ */
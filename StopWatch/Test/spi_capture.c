@@ -0,0 +1,46 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: spi_capture.c
+ * Description: Host SPI backend that records the frames given to SPI_sendFrame() (Replaces spi.c).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "spi_capture.h"
+
+uint16_t g_SpiCapture_Frames[SPI_CAPTURE_MAX_FRAMES];
+uint16_t g_SpiCapture_Count = 0;
+uint8_t g_SpiCapture_Inits = 0;
+int g_SpiCapture_Space = -1;
+
+void SpiCapture_clear(void)
+{
+	g_SpiCapture_Count = 0;
+}
+
+void SPI_initMaster(void)
+{
+	g_SpiCapture_Inits++;
+}
+
+uint8_t SPI_sendFrame(uint16_t frame)
+{
+	if ((g_SpiCapture_Space == 0) || (g_SpiCapture_Count == SPI_CAPTURE_MAX_FRAMES))
+	{
+		return 0;
+	}
+
+	if (g_SpiCapture_Space > 0)
+	{
+		g_SpiCapture_Space--;
+	}
+
+	g_SpiCapture_Frames[g_SpiCapture_Count++] = frame;
+
+	return 1;
+}
+
+uint8_t SPI_isIdle(void)
+{
+	return 1;
+}
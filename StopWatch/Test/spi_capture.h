@@ -0,0 +1,29 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: spi_capture.h
+ * Description: Host SPI backend that records the frames given to SPI_sendFrame() (Replaces spi.c).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef SPI_CAPTURE_H_
+#define SPI_CAPTURE_H_
+
+#include "spi.h"
+
+#define SPI_CAPTURE_MAX_FRAMES   256
+
+/* Frames accepted since the last SpiCapture_clear() (In the sending order) */
+extern uint16_t g_SpiCapture_Frames[SPI_CAPTURE_MAX_FRAMES];
+extern uint16_t g_SpiCapture_Count;
+
+/* Number of SPI_initMaster() calls */
+extern uint8_t g_SpiCapture_Inits;
+
+/* Frames accepted before SPI_sendFrame() returns 0 as a full queue (-1 --> Never full) */
+extern int g_SpiCapture_Space;
+
+/* Forget the recorded frames */
+void SpiCapture_clear(void);
+
+#endif /* SPI_CAPTURE_H_ */
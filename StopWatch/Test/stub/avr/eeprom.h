@@ -0,0 +1,23 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: eeprom.h
+ * Description: avr-libc EEPROM access functions (Emulated by eeprom_emu.c in the host tests).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STUB_AVR_EEPROM_H_
+#define STUB_AVR_EEPROM_H_
+
+#include <stdint.h>
+
+#define E2END   0x3FF
+
+/* bit_is_clear(EECR, EEWE) in avr-libc */
+uint8_t eeprom_is_ready(void);
+
+uint8_t eeprom_read_byte(const uint8_t *address);
+void eeprom_write_byte(uint8_t *address, uint8_t value);
+void eeprom_update_byte(uint8_t *address, uint8_t value);
+
+#endif /* STUB_AVR_EEPROM_H_ */
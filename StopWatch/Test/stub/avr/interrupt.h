@@ -0,0 +1,17 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: interrupt.h
+ * Description: Each (ISR) is a plain function that the host tests call by hand.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STUB_AVR_INTERRUPT_H_
+#define STUB_AVR_INTERRUPT_H_
+
+#define ISR(vector)   void vector(void)
+
+#define sei()
+#define cli()
+
+#endif /* STUB_AVR_INTERRUPT_H_ */
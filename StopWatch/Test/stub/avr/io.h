@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: io.h
+ * Description: ATmega32 I/O registers as plain variables for the host tests
+ *              (Defined in avr_stub.c , the tests play the hardware part).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STUB_AVR_IO_H_
+#define STUB_AVR_IO_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ *                                 Registers                                   *
+ *******************************************************************************/
+
+extern volatile uint8_t SREG, MCUCR, MCUCSR, GICR, GIFR, TIMSK, TIFR;
+extern volatile uint8_t PORTA, PORTB, PORTC, PORTD, DDRA, DDRB, DDRC, DDRD, PINA, PINB, PINC, PIND;
+extern volatile uint8_t TCCR0, TCNT0, TCCR1A, TCCR1B, TCCR2, TCNT2, OCR2, ASSR;
+extern volatile uint16_t TCNT1, OCR1A, OCR1B, ICR1;
+extern volatile uint8_t SPCR, SPSR, SPDR;
+extern volatile uint8_t UCSRA, UCSRB, UCSRC, UBRRL, UBRRH, UDR;
+extern volatile uint8_t WDTCR;
+
+/*******************************************************************************
+ *                                 Bit Numbers                                 *
+ *******************************************************************************/
+
+enum {PA0, PA1, PA2, PA3, PA4, PA5, PA6, PA7};
+enum {PB0, PB1, PB2, PB3, PB4, PB5, PB6, PB7};
+enum {PC0, PC1, PC2, PC3, PC4, PC5, PC6, PC7};
+enum {PD0, PD1, PD2, PD3, PD4, PD5, PD6, PD7};
+
+/* MCUCR , MCUCSR , GICR */
+#define ISC00   0
+#define ISC01   1
+#define ISC10   2
+#define ISC11   3
+#define ISC2    6
+#define INT0    6
+#define INT1    7
+#define INT2    5
+#define PORF    0
+#define EXTRF   1
+#define BORF    2
+#define WDRF    3
+
+/* TIMSK , TIFR */
+#define TOIE0   0
+#define TOV0    0
+#define TOIE1   2
+#define TOV1    2
+#define OCIE1B  3
+#define OCF1B   3
+#define OCIE1A  4
+#define OCF1A   4
+#define TICIE1  5
+#define ICF1    5
+#define TOIE2   6
+#define TOV2    6
+
+/* Timers control */
+#define CS00    0
+#define CS01    1
+#define CS02    2
+#define WGM10   0
+#define WGM11   1
+#define FOC1B   2
+#define FOC1A   3
+#define COM1B0  4
+#define COM1B1  5
+#define COM1A0  6
+#define COM1A1  7
+#define CS10    0
+#define CS11    1
+#define CS12    2
+#define WGM12   3
+#define WGM13   4
+#define ICES1   6
+#define ICNC1   7
+#define CS20    0
+#define CS21    1
+#define CS22    2
+#define TCR2UB  0
+#define OCR2UB  1
+#define TCN2UB  2
+#define AS2     3
+
+/* SPI */
+#define SPR0    0
+#define SPR1    1
+#define CPHA    2
+#define CPOL    3
+#define MSTR    4
+#define DORD    5
+#define SPE     6
+#define SPIE    7
+#define SPI2X   0
+#define SPIF    7
+
+/* UART */
+#define U2X     1
+#define UDRE    5
+#define TXC     6
+#define RXC     7
+#define TXEN    3
+#define RXEN    4
+#define UDRIE   5
+#define TXCIE   6
+#define RXCIE   7
+#define UCSZ0   1
+#define UCSZ1   2
+#define URSEL   7
+
+/* Watchdog */
+#define WDP0    0
+#define WDP1    1
+#define WDP2    2
+#define WDE     3
+#define WDTOE   4
+
+#endif /* STUB_AVR_IO_H_ */
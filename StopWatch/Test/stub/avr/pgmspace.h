@@ -0,0 +1,20 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: pgmspace.h
+ * Description: Flash constants are plain constants in the host tests.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STUB_AVR_PGMSPACE_H_
+#define STUB_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+
+#define pgm_read_byte(address)    (*(const uint8_t *)(address))
+#define pgm_read_word(address)    (*(const uint16_t *)(address))
+#define pgm_read_dword(address)   (*(const uint32_t *)(address))
+
+#endif /* STUB_AVR_PGMSPACE_H_ */
@@ -0,0 +1,22 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: wdt.h
+ * Description: avr-libc watchdog reset , each WDR instruction calls g_Stub_WdtResetHook in the host tests.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STUB_AVR_WDT_H_
+#define STUB_AVR_WDT_H_
+
+extern void (*g_Stub_WdtResetHook)(void);   /* The test plays the passing time between two main loop passes */
+
+static inline void wdt_reset(void)
+{
+	if (g_Stub_WdtResetHook)
+	{
+		g_Stub_WdtResetHook();
+	}
+}
+
+#endif /* STUB_AVR_WDT_H_ */
@@ -0,0 +1,30 @@
+/******************************************************************************
+ * Module: Host Test Stubs
+ * File Name: delay.h
+ * Description: Busy wait delays are only accumulated (g_Stub_DelayMs) by the host tests.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef STUB_UTIL_DELAY_H_
+#define STUB_UTIL_DELAY_H_
+
+extern double g_Stub_DelayMs;
+extern void (*g_Stub_DelayHook)(void);   /* Called by each delay (The test samples the ports while the code waits) */
+
+static inline void _delay_ms(double ms)
+{
+	g_Stub_DelayMs += ms;
+
+	if (g_Stub_DelayHook)
+	{
+		g_Stub_DelayHook();
+	}
+}
+
+static inline void _delay_us(double us)
+{
+	g_Stub_DelayMs += us / 1000.0;
+}
+
+#endif /* STUB_UTIL_DELAY_H_ */
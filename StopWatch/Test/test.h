@@ -0,0 +1,30 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test.h
+ * Description: Minimal check macros shared by the host tests.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdio.h>
+
+static int g_Test_Checks = 0;
+static int g_Test_Failures = 0;
+
+/* Count a check and print it if it fails (The test continues to report all the failures) */
+#define TEST_CHECK(condition) do { \
+		g_Test_Checks++; \
+		if (!(condition)) { \
+			g_Test_Failures++; \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+		} \
+	} while (0)
+
+/* Print the summary of the test , Return value of main() (0 --> All the checks passed) */
+#define TEST_RESULT(name) \
+	(printf("%-24s %6d checks , %d failed\n", (name), g_Test_Checks, g_Test_Failures), (g_Test_Failures != 0))
+
+#endif /* TEST_H_ */
@@ -0,0 +1,320 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_display.c
+ * Description: Host test of The Multiplexed Display refresh against a reference model ,
+ *              and the refresh cost before (Baseline multiplexing) and after the dirty digits gating.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "Display.h"
+#include <util/delay.h>
+
+#define TEST_OFF              0xFF      /* Expected slot of a 7-Segment that is not enabled */
+#define TEST_PROFILE_PASSES   2000000UL
+#define TEST_PASSES_PER_SEC   42        /* 6 x 4ms passes in one second */
+
+/*******************************************************************************
+ *                                Reference Model                              *
+ *******************************************************************************/
+
+static uint8_t g_Model_Digits[DISPLAY_DIGITS];
+static uint8_t g_Model_Attributes[DISPLAY_DIGITS];
+static uint8_t g_Model_BlinkCounter = 0;
+static uint8_t g_Model_BlinkOff = 0;
+
+/* Ports sampled in each digit slot of the last pass */
+static uint8_t g_Test_PortA[DISPLAY_DIGITS];
+static uint8_t g_Test_PortC[DISPLAY_DIGITS];
+static uint8_t g_Test_Slot = 0;
+
+static void Test_sampleSlot(void)
+{
+	if (g_Test_Slot < DISPLAY_DIGITS)
+	{
+		g_Test_PortA[g_Test_Slot] = PORTA;
+		g_Test_PortC[g_Test_Slot] = PORTC & 0x0F;
+	}
+
+	g_Test_Slot++;
+}
+
+static void Test_setDigit(uint8_t position, uint8_t value)
+{
+	Display_setDigit(position, value);
+	g_Model_Digits[position] = value;
+}
+
+static void Test_setAttributes(uint8_t digitsMask, uint8_t attributes)
+{
+	uint8_t count;
+
+	Display_setAttributes(digitsMask, attributes);
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		if (digitsMask & (1 << count))
+		{
+			g_Model_Attributes[count] = attributes;
+		}
+	}
+}
+
+/* Run one refresh pass and check each slot shows the digit of the model */
+static void Test_pass(void)
+{
+	uint8_t count;
+	uint8_t expected;
+
+	if (++g_Model_BlinkCounter >= DISPLAY_BLINK_PASSES)
+	{
+		g_Model_BlinkCounter = 0;
+		g_Model_BlinkOff ^= 1;
+	}
+
+	g_Test_Slot = 0;
+	Display_refresh();
+
+	TEST_CHECK(g_Test_Slot == DISPLAY_DIGITS);
+	TEST_CHECK(Display_getDirtyDigits() == 0);   /* Refresh consumed all the changes */
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		expected = g_Model_Digits[count];
+
+		if ((g_Model_Attributes[count] & DISPLAY_ATTR_BLANK) ||
+				((g_Model_Attributes[count] & DISPLAY_ATTR_BLINK) && g_Model_BlinkOff))
+		{
+			expected = TEST_OFF;
+		}
+
+		if (expected == TEST_OFF)
+		{
+			TEST_CHECK(g_Test_PortA[count] == 0);
+		}
+		else
+		{
+			TEST_CHECK(g_Test_PortA[count] == (1 << count));
+			TEST_CHECK(g_Test_PortC[count] == expected);
+		}
+	}
+}
+
+/*******************************************************************************
+ *                              Refresh Cost Profile                           *
+ *******************************************************************************/
+
+static uint8_t g_Base_Sec, g_Base_Min, g_Base_Hour;
+
+static unsigned long g_Profile_BusWrites = 0;    /* Decoder bus (PORTC) changes seen in the slots */
+static unsigned long g_Profile_Decodes = 0;      /* Digits decoded (Divisions before , dirty digits after) */
+static uint8_t g_Profile_LastBus = 0xFF;
+
+static void Test_countBusWrite(void)
+{
+	if ((PORTC & 0x0F) != g_Profile_LastBus)
+	{
+		g_Profile_BusWrites++;
+		g_Profile_LastBus = PORTC & 0x0F;
+	}
+}
+
+/* Write the time digits as StopWatch_DisplayTime() , only the changed digits become dirty */
+static void Test_displayBaseTime(void)
+{
+	uint8_t digits[DISPLAY_DIGITS] = {(g_Base_Sec % 10),(g_Base_Sec / 10),
+			                          (g_Base_Min % 10),(g_Base_Min / 10),
+			                          (g_Base_Hour % 10),(g_Base_Hour / 10)};
+	uint8_t count;
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		g_Profile_Decodes += (g_Model_Digits[count] != digits[count]);
+		Test_setDigit(count, digits[count]);
+	}
+}
+
+/* Multiplexing of the baseline firmware (Digits computed from the time and both ports written in every slot) */
+static void Baseline_Multiplexing_Mode(void)
+{
+	uint8_t timeDigits[] = {(g_Base_Sec % 10),(g_Base_Sec / 10),
+			                (g_Base_Min % 10),(g_Base_Min / 10),
+			                (g_Base_Hour % 10),(g_Base_Hour / 10)};
+
+	for(uint8_t count = 0; count < 6; count++)
+	{
+		PORTA = (1 << count);
+		PORTC = (PORTC & 0xF0) | timeDigits[count];
+		_delay_ms(4);
+	}
+}
+
+/* Baseline time processing of one second */
+static void Baseline_tick(void)
+{
+	if (++g_Base_Sec == 60)
+	{
+		g_Base_Sec = 0;
+
+		if (++g_Base_Min == 60)
+		{
+			g_Base_Min = 0;
+			g_Base_Hour = (g_Base_Hour + 1) % 100;
+		}
+	}
+}
+
+static double Test_seconds(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* Refresh work and host time of one pass of the baseline multiplexing and of Display_refresh ,
+ * both driven by the same one second time updates (The baseline writes PORTC in every slot)
+ */
+static void Test_profile(void)
+{
+	unsigned long pass;
+	double start;
+	double before;
+	double after;
+
+	/* Work per pass over one hour of passes */
+	Test_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_NONE);
+	g_Stub_DelayHook = Test_countBusWrite;
+
+	for (pass = 0; pass < 3600UL * TEST_PASSES_PER_SEC; pass++)
+	{
+		if ((pass % TEST_PASSES_PER_SEC) == 0)
+		{
+			Baseline_tick();
+			Test_displayBaseTime();
+		}
+
+		Display_refresh();
+	}
+
+	printf("refresh pass work        before %5.3f digit decodes , %5.3f bus writes , after %5.3f , %5.3f\n",
+			6.0, 6.0, (double)g_Profile_Decodes / pass, (double)g_Profile_BusWrites / pass);
+
+	TEST_CHECK(g_Profile_Decodes < pass / 4);
+	TEST_CHECK(g_Profile_BusWrites < 6 * pass);
+
+	/* Host time (Dominated by the stub delays , the divisions are cheap multiplications on the PC) */
+	g_Stub_DelayHook = 0;
+	g_Base_Sec = g_Base_Min = g_Base_Hour = 0;
+
+	start = Test_seconds();
+
+	for (pass = 0; pass < TEST_PROFILE_PASSES; pass++)
+	{
+		if ((pass % TEST_PASSES_PER_SEC) == 0)
+		{
+			Baseline_tick();
+		}
+
+		Baseline_Multiplexing_Mode();
+	}
+
+	before = (Test_seconds() - start) * 1e9 / TEST_PROFILE_PASSES;
+
+	start = Test_seconds();
+
+	for (pass = 0; pass < TEST_PROFILE_PASSES; pass++)
+	{
+		if ((pass % TEST_PASSES_PER_SEC) == 0)
+		{
+			Baseline_tick();
+			Test_displayBaseTime();
+		}
+
+		Display_refresh();
+	}
+
+	after = (Test_seconds() - start) * 1e9 / TEST_PROFILE_PASSES;
+
+	printf("refresh pass host time   before %6.1f ns , after %6.1f ns\n", before, after);
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+int main(void)
+{
+	uint32_t step;
+	uint8_t count;
+
+	g_Stub_DelayHook = Test_sampleSlot;
+
+	Display_Init();
+
+	/* All the digits are zeros after the initialization */
+	Test_pass();
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		Test_setDigit(count, count + 1);
+	}
+
+	Test_pass();
+
+	/* Blanked digit stays OFF in all the passes */
+	Test_setAttributes(1 << 5, DISPLAY_ATTR_BLANK);
+
+	for (step = 0; step < 4 * DISPLAY_BLINK_PASSES; step++)
+	{
+		Test_pass();
+	}
+
+	/* Blinking digits toggle each DISPLAY_BLINK_PASSES passes , a digit set in the OFF phase shows its new value after it */
+	Test_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_BLINK);
+
+	for (step = 0; step < 6 * DISPLAY_BLINK_PASSES; step++)
+	{
+		if (step % 7 == 0)
+		{
+			Test_setDigit(step % DISPLAY_DIGITS, step % 10);
+		}
+
+		Test_pass();
+	}
+
+	Test_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_NONE);
+	Test_pass();
+
+	/* Random digits and attributes changes between the passes */
+	srand(29);
+
+	for (step = 0; step < 200000; step++)
+	{
+		switch (rand() % 8)
+		{
+		case 0:
+			Test_setAttributes(rand() & DISPLAY_ALL_DIGITS, rand() % 3);
+			break;
+
+		case 1:
+		case 2:
+		case 3:
+			Test_setDigit(rand() % DISPLAY_DIGITS, rand() % 10);
+			break;
+
+		default:
+			break;
+		}
+
+		Test_pass();
+	}
+
+	Test_profile();
+
+	return TEST_RESULT("test_display");
+}
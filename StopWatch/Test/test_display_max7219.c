@@ -0,0 +1,226 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_display_max7219.c
+ * Description: Host test of The MAX7219 Display backend (DISPLAY_BACKEND = 1) from the SPI frames it sends :
+ *              Initialization sequence , digit registers , dirty digits only and the blink/blank paths.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "spi_capture.h"
+#include "Display.h"
+
+#if (DISPLAY_BACKEND != DISPLAY_BACKEND_MAX7219)
+#error "test_display_max7219 must be built with -DDISPLAY_BACKEND=1"
+#endif
+
+#define TEST_BLANK          0x0F      /* Code B blank */
+
+/*******************************************************************************
+ *                                Reference Model                              *
+ *******************************************************************************/
+
+static uint8_t g_Model_Digits[DISPLAY_DIGITS];
+static uint8_t g_Model_Attributes[DISPLAY_DIGITS];
+static uint8_t g_Model_Overflows = 0;
+static uint8_t g_Model_BlinkOff = 0;
+
+/* MAX7219 registers written by the captured frames (Address 0x00 ... 0x0F) */
+static uint8_t g_Chip_Registers[16];
+
+static uint8_t Test_expected(uint8_t position)
+{
+	if ((g_Model_Attributes[position] & DISPLAY_ATTR_BLANK) ||
+			((g_Model_Attributes[position] & DISPLAY_ATTR_BLINK) && g_Model_BlinkOff))
+	{
+		return TEST_BLANK;
+	}
+
+	return g_Model_Digits[position];
+}
+
+static void Test_setDigit(uint8_t position, uint8_t value)
+{
+	Display_setDigit(position, value);
+	g_Model_Digits[position] = value;
+}
+
+static void Test_setAttributes(uint8_t digitsMask, uint8_t attributes)
+{
+	uint8_t count;
+
+	Display_setAttributes(digitsMask, attributes);
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		if (digitsMask & (1 << count))
+		{
+			g_Model_Attributes[count] = attributes;
+		}
+	}
+}
+
+/* Timer0 overflow (Polled by the refresh for the blink time base) */
+static void Test_overflow(void)
+{
+	Stub_setFlag(TOV0);
+
+	if (++g_Model_Overflows >= DISPLAY_BLINK_OVERFLOWS)
+	{
+		g_Model_Overflows = 0;
+		g_Model_BlinkOff ^= 1;
+	}
+}
+
+/* Refresh and apply the sent frames to the chip registers , Return the number of frames */
+static uint16_t Test_refresh(int space)
+{
+	uint16_t count;
+
+	SpiCapture_clear();
+	g_SpiCapture_Space = space;
+
+	Display_refresh();
+
+	TEST_CHECK(!Stub_isFlagSet(TOV0));         /* Overflow flag is cleared by the refresh */
+
+	for (count = 0; count < g_SpiCapture_Count; count++)
+	{
+		TEST_CHECK((g_SpiCapture_Frames[count] >> 8) >= 0x01);
+		TEST_CHECK((g_SpiCapture_Frames[count] >> 8) <= DISPLAY_DIGITS);   /* Digit registers only */
+
+		g_Chip_Registers[g_SpiCapture_Frames[count] >> 8] = (uint8_t)g_SpiCapture_Frames[count];
+	}
+
+	return g_SpiCapture_Count;
+}
+
+/* Each digit register of the chip shows the model digit */
+static void Test_checkChip(void)
+{
+	uint8_t count;
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		TEST_CHECK(g_Chip_Registers[0x01 + count] == Test_expected(count));
+	}
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+int main(void)
+{
+	static const uint16_t initFrames[] = {0x0F00, 0x093F, 0x0A08, 0x0B05, 0x0C01};
+	uint32_t step;
+	uint8_t count;
+	uint16_t frames;
+
+	/* Initialization : Display test OFF , Code B for digits 0 ... 5 , Intensity , Scan limit 5 , Normal operation */
+	Display_Init();
+
+	TEST_CHECK(g_SpiCapture_Inits == 1);
+	TEST_CHECK(g_SpiCapture_Count == sizeof(initFrames) / sizeof(initFrames[0]));
+
+	for (count = 0; count < g_SpiCapture_Count; count++)
+	{
+		TEST_CHECK(g_SpiCapture_Frames[count] == initFrames[count]);
+	}
+
+	TEST_CHECK(TCCR0 == ((1 << CS02) | (1 << CS00)));   /* Timer0 F_CPU/1024 blink time base */
+
+	/* First refresh sends all the digits , digit i --> register 0x01 + i */
+	TEST_CHECK(Test_refresh(-1) == DISPLAY_DIGITS);
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		TEST_CHECK(g_SpiCapture_Frames[count] == ((0x01 + count) << 8));
+	}
+
+	/* Nothing changed --> Nothing sent */
+	TEST_CHECK(Test_refresh(-1) == 0);
+
+	/* Only the changed digit is sent */
+	Test_setDigit(3, 7);
+	TEST_CHECK(Test_refresh(-1) == 1);
+	TEST_CHECK(g_SpiCapture_Frames[0] == 0x0407);
+
+	Test_setDigit(3, 7);
+	TEST_CHECK(Test_refresh(-1) == 0);
+
+	/* Blank attribute sends the Code B blank */
+	Test_setAttributes(1 << 2, DISPLAY_ATTR_BLANK);
+	TEST_CHECK(Test_refresh(-1) == 1);
+	TEST_CHECK(g_SpiCapture_Frames[0] == 0x030F);
+
+	/* Blink : The blinking digits are sent again each DISPLAY_BLINK_OVERFLOWS Timer0 overflows */
+	Test_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_BLINK);
+	TEST_CHECK(Test_refresh(-1) == DISPLAY_DIGITS);
+	Test_checkChip();
+
+	for (step = 0; step < 8 * DISPLAY_BLINK_OVERFLOWS; step++)
+	{
+		Test_overflow();
+		frames = Test_refresh(-1);
+
+		TEST_CHECK(frames == ((g_Model_Overflows == 0) ? DISPLAY_DIGITS : 0));
+		Test_checkChip();
+	}
+
+	/* Queue full : The digits that are not queued stay dirty and are sent by the next refreshes */
+	Test_setAttributes(DISPLAY_ALL_DIGITS, DISPLAY_ATTR_NONE);
+	Test_refresh(-1);
+
+	for (count = 0; count < DISPLAY_DIGITS; count++)
+	{
+		Test_setDigit(count, 9 - count);
+	}
+
+	TEST_CHECK(Test_refresh(2) == 2);
+	TEST_CHECK(Test_refresh(0) == 0);
+	TEST_CHECK(Test_refresh(2) == 2);
+	TEST_CHECK(Test_refresh(5) == 2);
+	TEST_CHECK(Test_refresh(-1) == 0);
+	Test_checkChip();
+
+	/* Random digits , attributes , overflows and queue space */
+	srand(31);
+
+	for (step = 0; step < 200000; step++)
+	{
+		switch (rand() % 8)
+		{
+		case 0:
+			Test_setAttributes(rand() & DISPLAY_ALL_DIGITS, rand() % 3);
+			break;
+
+		case 1:
+		case 2:
+			Test_setDigit(rand() % DISPLAY_DIGITS, rand() % 10);
+			break;
+
+		case 3:
+			Test_overflow();
+			break;
+
+		default:
+			break;
+		}
+
+		Test_refresh(rand() % 4);
+
+		if (rand() % 4 == 0)
+		{
+			/* Queue has space again --> All the changes reach the chip , then nothing is left to send */
+			Test_refresh(-1);
+			Test_checkChip();
+			TEST_CHECK(Test_refresh(-1) == 0);
+		}
+	}
+
+	return TEST_RESULT("test_display_max7219");
+}
@@ -0,0 +1,291 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_elapsed_time.c
+ * Description: Host test of The Fixed-Point Time Arithmetic : Exhaustive over the 24 hours range against
+ *              the integer division and a microbenchmark of the conversions.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#include "test.h"
+#include "Elapsed_Time.h"
+
+#define TEST_WINDOW_ERROR           (TIME_TIMER1_NOMINAL_WINDOW >> 3)   /* Timer1 rates within 1/8 of the nominal */
+#define TEST_RANDOM_PAIRS           1000000UL
+#define TEST_BENCH_TIMES            2000000UL
+
+/* Divisors read at run time so the reference uses a real division (As the AVR software division) */
+static volatile uint32_t g_Test_Div3600 = 3600;
+static volatile uint32_t g_Test_Div60 = 60;
+static volatile uint32_t g_Test_Div10 = 10;
+
+static volatile uint32_t g_Test_Sink;   /* Keeps the benchmarked results */
+
+/*******************************************************************************
+ *                               Division Reference                            *
+ *******************************************************************************/
+
+static void Test_referenceHMS(uint32_t ticks, Time_HMSType *hms)
+{
+	uint32_t seconds = ticks / TIME_TICKS_PER_SECOND;
+
+	hms->hour = (uint8_t)(seconds / g_Test_Div3600);
+	hms->min = (uint8_t)((seconds % g_Test_Div3600) / g_Test_Div60);
+	hms->sec = (uint8_t)(seconds % g_Test_Div60);
+}
+
+static void Test_referenceBCD(uint32_t ticks, uint8_t *digits)
+{
+	Time_HMSType hms;
+
+	Test_referenceHMS(ticks, &hms);
+
+	digits[0] = hms.sec % g_Test_Div10;
+	digits[1] = hms.sec / g_Test_Div10;
+	digits[2] = hms.min % g_Test_Div10;
+	digits[3] = hms.min / g_Test_Div10;
+	digits[4] = hms.hour % g_Test_Div10;
+	digits[5] = hms.hour / g_Test_Div10;
+}
+
+static uint32_t Test_random32(void)
+{
+	return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+/*******************************************************************************
+ *                                   Tests                                     *
+ *******************************************************************************/
+
+/* Each tick of the day to HH:MM:SS , each second to BCD digits and back from HH:MM:SS */
+static void Test_conversions(void)
+{
+	Time_HMSType hms;
+	Time_HMSType expected;
+	uint8_t digits[TIME_BCD_DIGITS];
+	uint8_t expectedDigits[TIME_BCD_DIGITS];
+	uint32_t ticks;
+	uint32_t errors = 0;
+	uint8_t count;
+
+	for (ticks = 0; ticks < TIME_TICKS_PER_DAY; ticks++)
+	{
+		Time_toHMS(Time_fromTicks(ticks), &hms);
+		Test_referenceHMS(ticks, &expected);
+
+		errors += (hms.hour != expected.hour) || (hms.min != expected.min) || (hms.sec != expected.sec);
+
+		if ((ticks & (TIME_TICKS_PER_SECOND - 1)) == 0)
+		{
+			TEST_CHECK(Time_toTicks(Time_fromHMS(&expected)) == ticks);
+
+			Time_toBCD(Time_fromTicks(ticks + (Test_random32() & (TIME_TICKS_PER_SECOND - 1))), digits);
+			Test_referenceBCD(ticks, expectedDigits);
+
+			for (count = 0; count < TIME_BCD_DIGITS; count++)
+			{
+				TEST_CHECK(digits[count] == expectedDigits[count]);
+			}
+		}
+	}
+
+	TEST_CHECK(errors == 0);
+}
+
+/* Each Timer1 count of the day to time ticks within 1/32 tick of the nearest (Nominal , untrimmed and the
+ * extreme rates) , the run time scale of each rate against the 64-bit one and longer counts give the last tick
+ */
+static void Test_fromTimer1Ticks(void)
+{
+	const uint32_t windows[] = {TIME_TIMER1_NOMINAL_WINDOW, TIME_TIMER1_TICKS_PER_SECOND << TIME_TIMER1_WINDOW_SHIFT,
+			TIME_TIMER1_NOMINAL_WINDOW - TEST_WINDOW_ERROR, TIME_TIMER1_NOMINAL_WINDOW + TEST_WINDOW_ERROR};
+	uint32_t window;
+	uint32_t scale;
+	uint32_t timer1Ticks;
+	uint32_t ticksPerDay;
+	uint32_t ticks;
+	uint32_t errors = 0;
+	uint32_t inexact = 0;
+	int64_t distance;
+	uint8_t index;
+
+	for (window = TIME_TIMER1_NOMINAL_WINDOW - TEST_WINDOW_ERROR; window <= TIME_TIMER1_NOMINAL_WINDOW + TEST_WINDOW_ERROR;
+			window++)
+	{
+		errors += (Time_timer1Scale(window) != TIME_TIMER1_SCALE(window));
+	}
+
+	TEST_CHECK(errors == 0);
+	TEST_CHECK(TIME_TIMER1_NOMINAL_WINDOW == 15625);
+
+	for (index = 0; index < sizeof(windows) / sizeof(windows[0]); index++)
+	{
+		window = windows[index];
+		scale = Time_timer1Scale(window);
+		ticksPerDay = (uint32_t)((86400ULL * window) >> TIME_TIMER1_WINDOW_SHIFT);
+		errors = 0;
+
+		for (timer1Ticks = 0; timer1Ticks < ticksPerDay; timer1Ticks++)
+		{
+			ticks = Time_toTicks(Time_fromTimer1Ticks(timer1Ticks, scale));
+
+			/* 32 * (ticks - exact) in units of 1/window : At most 1/2 + 1/32 tick */
+			distance = ((int64_t)ticks * window - ((int64_t)timer1Ticks << (TIME_TICK_SHIFT + TIME_TIMER1_WINDOW_SHIFT))) * 32;
+			errors += (distance > 17 * (int64_t)window) || (distance < -17 * (int64_t)window);
+			inexact += (ticks != (uint32_t)((((uint64_t)timer1Ticks << (TIME_TICK_SHIFT + TIME_TIMER1_WINDOW_SHIFT + 1))
+					+ window) / (2 * window)));
+		}
+
+		TEST_CHECK(errors == 0);
+		TEST_CHECK(Time_toTicks(Time_fromTimer1Ticks(ticksPerDay, scale)) == TIME_TICKS_PER_DAY - 1);
+		TEST_CHECK(Time_toTicks(Time_fromTimer1Ticks(1UL << 27, scale)) == TIME_TICKS_PER_DAY - 1);
+		TEST_CHECK(Time_toTicks(Time_fromTimer1Ticks(0xFFFFFFFFUL, scale)) == TIME_TICKS_PER_DAY - 1);
+	}
+
+	printf("  Timer1 ticks : %u counts of the 4 days are 1 tick off the nearest (Within 1/32 tick of a half)\n", (unsigned)inexact);
+}
+
+/* Each tick of the first hour to MM:SS and hundredths , each second of the rest of the day as Time_toBCD() */
+static void Test_toLapBCD(void)
+{
+	uint8_t digits[TIME_BCD_DIGITS];
+	uint8_t expectedDigits[TIME_BCD_DIGITS];
+	uint32_t ticks;
+	uint32_t hundredths;
+	uint32_t errors = 0;
+	uint8_t count;
+
+	for (ticks = 0; ticks < TIME_TICKS_PER_DAY; ticks++)
+	{
+		if (ticks < (3600UL << TIME_TICK_SHIFT))
+		{
+			Test_referenceBCD(ticks, expectedDigits);
+
+			/* Hundredths instead of the hours , the minutes and seconds move down one pair */
+			hundredths = (ticks % TIME_TICKS_PER_SECOND) * 100 / TIME_TICKS_PER_SECOND;
+
+			for (count = 5; count >= 2; count--)
+			{
+				expectedDigits[count] = expectedDigits[count - 2];
+			}
+
+			expectedDigits[0] = hundredths % g_Test_Div10;
+			expectedDigits[1] = hundredths / g_Test_Div10;
+		}
+		else if ((ticks & (TIME_TICKS_PER_SECOND - 1)) == 0)
+		{
+			Test_referenceBCD(ticks, expectedDigits);
+		}
+		else
+		{
+			continue;
+		}
+
+		Time_toLapBCD(Time_fromTicks(ticks), digits);
+
+		for (count = 0; count < TIME_BCD_DIGITS; count++)
+		{
+			errors += (digits[count] != expectedDigits[count]);
+		}
+	}
+
+	TEST_CHECK(errors == 0);
+}
+
+/* Add , subtract and compare wrap at the end of the day (Edges and random pairs) */
+static void Test_arithmetic(void)
+{
+	static const uint32_t edges[] = {0, 1, TIME_TICKS_PER_SECOND, TIME_TICKS_PER_DAY / 2,
+			TIME_TICKS_PER_DAY - TIME_TICKS_PER_SECOND, TIME_TICKS_PER_DAY - 1};
+	uint32_t a;
+	uint32_t b;
+	uint32_t count;
+
+	for (count = 0; count < TEST_RANDOM_PAIRS + 36; count++)
+	{
+		if (count < 36)
+		{
+			a = edges[count / 6];
+			b = edges[count % 6];
+		}
+		else
+		{
+			a = Test_random32() % TIME_TICKS_PER_DAY;
+			b = Test_random32() % TIME_TICKS_PER_DAY;
+		}
+
+		TEST_CHECK(Time_toTicks(Time_add(Time_fromTicks(a), Time_fromTicks(b))) == (a + b) % TIME_TICKS_PER_DAY);
+		TEST_CHECK(Time_toTicks(Time_sub(Time_fromTicks(a), Time_fromTicks(b))) ==
+				(a + TIME_TICKS_PER_DAY - b) % TIME_TICKS_PER_DAY);
+		TEST_CHECK(Time_compare(Time_fromTicks(a), Time_fromTicks(b)) == ((a < b) ? -1 : (a > b)));
+	}
+}
+
+/* Host time of each conversion against the same conversion with the division */
+static void Test_benchmark(void)
+{
+	Time_HMSType hms;
+	uint8_t digits[TIME_BCD_DIGITS];
+	double results[5];
+	clock_t start;
+	uint32_t count;
+	uint32_t ticks;
+	uint8_t index;
+
+	for (index = 0; index < 5; index++)
+	{
+		start = clock();
+
+		for (count = 0; count < TEST_BENCH_TIMES; count++)
+		{
+			ticks = (count * 2654435761UL) % TIME_TICKS_PER_DAY;
+
+			switch (index)
+			{
+			case 0:
+				Time_toHMS(Time_fromTicks(ticks), &hms);
+				g_Test_Sink = hms.sec;
+				break;
+			case 1:
+				Test_referenceHMS(ticks, &hms);
+				g_Test_Sink = hms.sec;
+				break;
+			case 2:
+				Time_toBCD(Time_fromTicks(ticks), digits);
+				g_Test_Sink = digits[0];
+				break;
+			case 3:
+				Test_referenceBCD(ticks, digits);
+				g_Test_Sink = digits[0];
+				break;
+			default:
+				g_Test_Sink = Time_toTicks(Time_fromTimer1Ticks(ticks, TIME_TIMER1_NOMINAL_SCALE));
+				break;
+			}
+		}
+
+		results[index] = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / TEST_BENCH_TIMES;
+	}
+
+	printf("  Host : HH:MM:SS %.1f ns (division %.1f ns) , BCD %.1f ns (division %.1f ns) , Timer1 ticks %.1f ns\n",
+			results[0], results[1], results[2], results[3], results[4]);
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+int main(void)
+{
+	srand(34);
+
+	Test_conversions();
+	Test_fromTimer1Ticks();
+	Test_toLapBCD();
+	Test_arithmetic();
+	Test_benchmark();
+
+	return TEST_RESULT("test_elapsed_time");
+}
@@ -0,0 +1,235 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_input_capture.c
+ * Description: Host test of The Timer1 Input Capture timestamps , queue and flush.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "timer1_sim.h"
+#include "Input_Capture.h"
+
+void TIMER1_CAPT_vect(void);
+
+static void Test_compareIsr(void)
+{
+	ICU_timerPeriodElapsed();
+}
+
+/* Gate edge now , its capture (ISR) is served at once */
+static void Test_edge(void)
+{
+	Timer1Sim_capture();
+	Timer1Sim_serveCapture(TIMER1_CAPT_vect);
+}
+
+/* Timer1 at the Stop Watch configuration , the queue is emptied (Base ticks are kept) */
+static void Test_start(void)
+{
+	uint32_t timestamp;
+
+	Timer1Sim_reset();
+	OCR1A = 977;
+	TCCR1B = (1 << WGM12) | (1 << CS12) | (1 << CS10);
+
+	while (ICU_getCapture(&timestamp));
+}
+
+/* Timestamps follow the Timer1 ticks across the CTC wraps , also when the Compare A (ISR) is late */
+static void Test_timestamps(void)
+{
+	uint32_t offset;
+	uint32_t tick;
+	uint8_t late = 0;
+
+	Test_start();
+	ICU_Init(ICU_FALLING_EDGE);
+	offset = ICU_getTimestamp();
+
+	for (tick = 0; tick < 20000; tick++)
+	{
+		Timer1Sim_tick();
+
+		if (Stub_isFlagSet(OCF1A) && (late == 0))
+		{
+			late = (uint8_t)(1 + rand() % 4);     /* Other interrupts delay the Compare A (ISR) */
+		}
+
+		if ((late != 0) && (--late == 0))
+		{
+			Timer1Sim_serveCompare(Test_compareIsr);
+		}
+
+		TEST_CHECK(ICU_getTimestamp() - offset == g_Timer1Sim_Ticks);
+	}
+}
+
+/* Captured edges keep their exact Timer1 tick , the capture (ISR) runs before a pending Compare A */
+static void Test_captures(void)
+{
+	uint32_t offset;
+	uint32_t expected[ICU_QUEUE_SIZE];
+	uint32_t timestamp;
+	uint8_t count = 0;
+	uint8_t index;
+	uint32_t tick;
+
+	Test_start();
+	offset = ICU_getTimestamp();
+
+	for (tick = 0; tick < 50000; tick++)
+	{
+		Timer1Sim_tick();
+
+		/* Edges near the wrap while the Compare A flag is still pending are the hard case */
+		if ((rand() % 97 == 0) || (Stub_isFlagSet(OCF1A) && (rand() % 3 == 0)))
+		{
+			expected[count++] = g_Timer1Sim_Ticks;
+			Test_edge();
+		}
+
+		if (rand() % 3 == 0)
+		{
+			Timer1Sim_serveCompare(Test_compareIsr);
+		}
+
+		if (count == ICU_QUEUE_SIZE - 1)
+		{
+			for (index = 0; index < count; index++)
+			{
+				TEST_CHECK(ICU_getCapture(&timestamp) && (timestamp - offset == expected[index]));
+			}
+
+			TEST_CHECK(!ICU_getCapture(&timestamp));
+			count = 0;
+		}
+	}
+}
+
+/* Time preset restarts Timer1 at any point (Also with a pending capture or Compare A) , the timestamps and the
+ * captured edges still follow the Timer1 ticks
+ */
+static void Test_rebase(void)
+{
+	uint32_t offset;
+	uint32_t expected[ICU_QUEUE_SIZE];
+	uint32_t timestamp;
+	uint8_t count = 0;
+	uint8_t index;
+	uint32_t tick;
+	uint32_t rebases = 0;
+
+	Test_start();
+	ICU_Init(ICU_FALLING_EDGE);
+	offset = ICU_getTimestamp();
+
+	for (tick = 0; tick < 50000; tick++)
+	{
+		Timer1Sim_tick();
+
+		/* Edge is latched while the previous one is served (ICR1 keeps one capture) */
+		if (!Stub_isFlagSet(ICF1) && ((rand() % 97 == 0) || (Stub_isFlagSet(OCF1A) && (rand() % 3 == 0))))
+		{
+			expected[count++] = g_Timer1Sim_Ticks;
+			Timer1Sim_capture();      /* Served later (Or by the rebase) */
+		}
+
+		if ((rand() % 61 == 0) || (Stub_isFlagSet(OCF1A) && (rand() % 4 == 0)))
+		{
+			ICU_rebase();
+			rebases++;
+
+			TEST_CHECK(TCNT1 == 0);
+			TEST_CHECK(!Stub_isFlagSet(OCF1A));
+			TEST_CHECK(!Stub_isFlagSet(ICF1));
+			TEST_CHECK(BIT_IS_CLEAR(SREG, I_BIT));
+		}
+
+		if (rand() % 3 == 0)
+		{
+			Timer1Sim_serveCapture(TIMER1_CAPT_vect);
+		}
+
+		if (rand() % 3 == 0)
+		{
+			Timer1Sim_serveCompare(Test_compareIsr);
+		}
+
+		TEST_CHECK(ICU_getTimestamp() - offset == g_Timer1Sim_Ticks);
+
+		if (count == ICU_QUEUE_SIZE - 1)
+		{
+			Timer1Sim_serveCapture(TIMER1_CAPT_vect);
+
+			for (index = 0; index < count; index++)
+			{
+				TEST_CHECK(ICU_getCapture(&timestamp) && (timestamp - offset == expected[index]));
+			}
+
+			TEST_CHECK(!ICU_getCapture(&timestamp));
+			count = 0;
+		}
+	}
+
+	TEST_CHECK(rebases > 500);
+}
+
+/* Full queue keeps the oldest edges , flush drops the queued and the pending edges only */
+static void Test_queueAndFlush(void)
+{
+	uint32_t first;
+	uint32_t timestamp;
+	uint8_t count;
+
+	Test_start();
+	first = ICU_getTimestamp();
+
+	for (count = 0; count < ICU_QUEUE_SIZE + 2; count++)
+	{
+		Test_edge();
+		Timer1Sim_tick();
+	}
+
+	/* One entry is kept free to tell a full queue from an empty one */
+	for (count = 0; count < ICU_QUEUE_SIZE - 1; count++)
+	{
+		TEST_CHECK(ICU_getCapture(&timestamp) && (timestamp == first + count));
+	}
+
+	TEST_CHECK(!ICU_getCapture(&timestamp));
+
+	/* RESET : Two queued edges , one edge captured while the RESET (ISR) runs and a pending second */
+	Test_edge();
+	Test_edge();
+	Timer1Sim_capture();
+	Stub_setFlag(OCF1A);
+
+	ICU_flush();
+
+	TEST_CHECK(!Stub_isFlagSet(ICF1));
+	TEST_CHECK(Stub_isFlagSet(OCF1A));        /* The Stop-Watch second must not be lost */
+	Timer1Sim_serveCapture(TIMER1_CAPT_vect);
+	TEST_CHECK(!ICU_getCapture(&timestamp));
+	Stub_clearFlag(OCF1A);
+
+	/* First edge after the RESET is queued normally */
+	Timer1Sim_tick();
+	Test_edge();
+	TEST_CHECK(ICU_getCapture(&timestamp) && (timestamp == first + ICU_QUEUE_SIZE + 3));
+	TEST_CHECK(!ICU_getCapture(&timestamp));
+}
+
+int main(void)
+{
+	srand(26);
+
+	Test_timestamps();
+	Test_captures();
+	Test_rebase();
+	Test_queueAndFlush();
+
+	return TEST_RESULT("test_input_capture");
+}
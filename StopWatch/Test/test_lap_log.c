@@ -0,0 +1,549 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_lap_log.c
+ * Description: Host test of The Compressed Lap/Session Log on the EEPROM emulator : Capacity ,
+ *              One lap sessions , Corrupted blocks , Power failure at each EEPROM write , Non-blocking
+ *              writes and power-on scan and throughput.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <time.h>
+#include "test.h"
+#include "eeprom_emu.h"
+#include "Lap_Log.h"
+
+#define TEST_MAX_LAPS          4000
+#define TEST_BASE_LAP          29297UL        /* 30 seconds in Timer1 ticks (F_CPU/1024) */
+#define TEST_POWER_FAIL_LAPS   1200
+
+/*******************************************************************************
+ *                                Reference Log                                *
+ *******************************************************************************/
+
+/* All the appended laps (The log must hold the newest ones) */
+static uint32_t g_Test_Laps[TEST_MAX_LAPS];
+static uint8_t g_Test_Sessions[TEST_MAX_LAPS];
+static int g_Test_Count = 0;
+
+/* Laps read back from the log and the block of each one */
+static uint32_t g_Read_Laps[TEST_MAX_LAPS];
+static uint8_t g_Read_Sessions[TEST_MAX_LAPS];
+static uint8_t g_Read_Blocks[TEST_MAX_LAPS];
+static int g_Read_Count = 0;
+
+static jmp_buf g_Test_PowerFail;
+
+static void Test_powerFail(void)
+{
+	longjmp(g_Test_PowerFail, 1);
+}
+
+/* Main loop passes until the scan and the queued writes are done */
+static void Test_process(void)
+{
+	while (LapLog_process())
+	{
+	}
+}
+
+/* Power-on : The RAM state is found again by the scan of LapLog_Init() */
+static void Test_powerOn(void)
+{
+	LapLog_Init();
+	Test_process();
+}
+
+/* Power-on with an erased EEPROM */
+static void Test_clear(void)
+{
+	EepromEmu_erase();
+	g_Test_Count = 0;
+	Test_powerOn();
+}
+
+static void Test_append(uint32_t lap, uint8_t session)
+{
+	if (session)
+	{
+		LapLog_startSession();
+	}
+
+	/* Reference is updated first : A power failure in the append may keep the lap or not */
+	g_Test_Laps[g_Test_Count] = lap;
+	g_Test_Sessions[g_Test_Count] = session;
+	g_Test_Count++;
+
+	LapLog_append(Time_fromTicks(lap));
+	Test_process();
+}
+
+static void Test_readLog(void)
+{
+	LapLog_ReaderType reader;
+	Time_Type lap;
+
+	g_Read_Count = 0;
+	LapLog_openReader(&reader);
+
+	while ((g_Read_Count < TEST_MAX_LAPS) && LapLog_readNext(&reader, &lap, &g_Read_Sessions[g_Read_Count]))
+	{
+		g_Read_Laps[g_Read_Count] = Time_toTicks(lap);
+		g_Read_Blocks[g_Read_Count] = reader.block;
+		g_Read_Count++;
+	}
+}
+
+/* Read log is the newest laps of the reference ending at lap (end - 1) , Return 1 if it is */
+static uint8_t Test_isSuffix(int end)
+{
+	int count;
+
+	if (g_Read_Count > end)
+	{
+		return 0;
+	}
+
+	for (count = 0; count < g_Read_Count; count++)
+	{
+		if ((g_Read_Laps[count] != g_Test_Laps[end - g_Read_Count + count]) ||
+			(g_Read_Sessions[count] != g_Test_Sessions[end - g_Read_Count + count]))
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/* Random lap around the base lap */
+static uint32_t Test_lap(uint32_t spread)
+{
+	return TEST_BASE_LAP - spread + (uint32_t)(((unsigned long)rand() * 2 + rand() % 2) % (2 * spread + 1));
+}
+
+/*******************************************************************************
+ *                                    Tests                                    *
+ *******************************************************************************/
+
+/* Laps kept by the full log for each lap spread (One session) */
+static void Test_capacity(void)
+{
+	static const uint32_t spreads[] = {0, 50, 500, 2000, 20000};
+	static const int minimumLaps[] = {2800, 900, 580, 490, 360};
+	unsigned long writes;
+	uint8_t index;
+	int count;
+
+	printf("  Spread (ticks)  Laps kept  Bits/lap  EEPROM writes/lap\n");
+
+	for (index = 0; index < sizeof(spreads) / sizeof(spreads[0]); index++)
+	{
+		Test_clear();
+
+		for (count = 0; count < TEST_MAX_LAPS / 2; count++)
+		{
+			Test_append(Test_lap(spreads[index]), count == 0);
+		}
+
+		writes = g_EepromEmu_Writes;
+
+		for (; count < TEST_MAX_LAPS; count++)
+		{
+			Test_append(Test_lap(spreads[index]), 0);
+		}
+
+		writes = g_EepromEmu_Writes - writes;
+
+		Test_readLog();
+		TEST_CHECK(Test_isSuffix(g_Test_Count));
+		TEST_CHECK(g_Read_Count >= minimumLaps[index]);
+
+		printf("  %14lu  %9d  %8.1f  %17.2f\n", (unsigned long)spreads[index], g_Read_Count,
+				(double)(LAPLOG_BLOCKS - 1) * LAPLOG_PAYLOAD_BITS / g_Read_Count,
+				(double)writes / (TEST_MAX_LAPS / 2));
+	}
+}
+
+/* Each session is kept in the same block (100 one lap sessions are all kept) */
+static void Test_sessions(void)
+{
+	int count;
+
+	Test_clear();
+
+	for (count = 0; count < 100; count++)
+	{
+		Test_append(Test_lap(2000), 1);
+	}
+
+	Test_readLog();
+	TEST_CHECK(g_Read_Count == 100);
+	TEST_CHECK(Test_isSuffix(g_Test_Count));
+
+	/* Continue in the same block after the power-on */
+	Test_powerOn();
+	Test_append(Test_lap(2000), 0);
+	Test_append(Test_lap(2000), 1);
+
+	Test_readLog();
+	TEST_CHECK(g_Read_Count == 102);
+	TEST_CHECK(Test_isSuffix(g_Test_Count));
+}
+
+/* Read log is the log before the corruption without its laps from first (first + lost - 1) , Return 1 if it is */
+static uint8_t Test_isLogWithout(const uint32_t *laps, int count, int first, int lost)
+{
+	int index;
+
+	if (g_Read_Count != count - lost)
+	{
+		return 0;
+	}
+
+	for (index = 0; index < g_Read_Count; index++)
+	{
+		if (g_Read_Laps[index] != laps[(index < first) ? index : (index + lost)])
+		{
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/* Corrupted byte of a block only loses the laps of that block (Or only its last lap if it is in the committed slot) */
+static void Test_corruption(void)
+{
+	static uint32_t laps[TEST_MAX_LAPS];
+	uint16_t address;
+	int before;
+	int blockLaps;
+	int first;
+	int count;
+
+	for (address = 0; address < LAPLOG_EEPROM_SIZE; address++)
+	{
+		Test_clear();
+
+		for (count = 0; count < 1000; count++)
+		{
+			Test_append(Test_lap(500), (count % 100) == 0);
+		}
+
+		Test_readLog();
+		before = g_Read_Count;
+
+		for (count = 0, blockLaps = 0, first = -1; count < g_Read_Count; count++)
+		{
+			laps[count] = g_Read_Laps[count];
+
+			if (g_Read_Blocks[count] == address / LAPLOG_BLOCK_SIZE)
+			{
+				first = (first < 0) ? count : first;
+				blockLaps++;
+			}
+		}
+
+		g_EepromEmu_Memory[address] ^= 1 << (rand() % 8);
+		Test_readLog();
+
+		TEST_CHECK(Test_isLogWithout(laps, before, 0, 0) ||
+				   ((first >= 0) && (Test_isLogWithout(laps, before, first, blockLaps) ||
+									 Test_isLogWithout(laps, before, first + blockLaps - 1, 1))));
+
+		/* Appending continues after the power-on */
+		Test_powerOn();
+		Test_append(123456, 1);
+		Test_readLog();
+		TEST_CHECK((g_Read_Count > 0) && (g_Read_Laps[g_Read_Count - 1] == 123456) && g_Read_Sessions[g_Read_Count - 1]);
+	}
+}
+
+/* Power failure at each EEPROM write of the appends : Only the interrupted lap may be lost */
+static void Test_powerFailure(void)
+{
+	static uint32_t laps[TEST_POWER_FAIL_LAPS];
+	static uint8_t sessions[TEST_POWER_FAIL_LAPS];
+	static unsigned long startWrites[TEST_POWER_FAIL_LAPS + 1];   /* Writes before each append */
+	volatile int count;
+	unsigned long failWrite;
+	int failLap = 0;
+	volatile int before;
+	volatile int oldestLaps;
+
+	for (count = 0; count < TEST_POWER_FAIL_LAPS; count++)
+	{
+		laps[count] = Test_lap(((count / 200) % 2) ? 20000 : 300);
+		sessions[count] = (rand() % 50) == 0;
+	}
+
+	/* Reference run without power failure */
+	Test_clear();
+
+	for (count = 0; count < TEST_POWER_FAIL_LAPS; count++)
+	{
+		startWrites[count] = g_EepromEmu_Writes;
+		Test_append(laps[count], sessions[count]);
+	}
+
+	startWrites[TEST_POWER_FAIL_LAPS] = g_EepromEmu_Writes;
+	g_EepromEmu_FailHook = Test_powerFail;
+
+	for (failWrite = 1; failWrite <= startWrites[TEST_POWER_FAIL_LAPS]; failWrite++)
+	{
+		while (startWrites[failLap + 1] < failWrite)
+		{
+			failLap++;            /* Append interrupted by this write */
+		}
+
+		Test_clear();
+		before = 0;
+		oldestLaps = 0;
+
+		/* Half programmed byte : Some of the zero bits of the written value are still at one */
+		g_EepromEmu_FailMask = (failWrite % 3) ? (uint8_t)(failWrite * 37) : 0xFF;
+		g_EepromEmu_WritesToFail = failWrite;
+
+		if (setjmp(g_Test_PowerFail) == 0)
+		{
+			for (count = 0; count < TEST_POWER_FAIL_LAPS; count++)
+			{
+				if (count == failLap)
+				{
+					Test_readLog();
+					before = g_Read_Count;
+
+					while ((oldestLaps < g_Read_Count) && (g_Read_Blocks[oldestLaps] == g_Read_Blocks[0]))
+					{
+						oldestLaps++;
+					}
+				}
+
+				Test_append(laps[count], sessions[count]);
+			}
+		}
+
+		TEST_CHECK(g_EepromEmu_WritesToFail == 0);
+		TEST_CHECK(g_EepromEmu_Writes == failWrite - 1);
+
+		/* Reference is the laps up to the interrupted one (The test variables are not reliable after longjmp) */
+		for (g_Test_Count = 0; g_Test_Count <= failLap; g_Test_Count++)
+		{
+			g_Test_Laps[g_Test_Count] = laps[g_Test_Count];
+			g_Test_Sessions[g_Test_Count] = sessions[g_Test_Count];
+		}
+
+		/* Power-on : The log has all the laps before the interrupted one (Except an overwritten oldest block) */
+		Test_powerOn();
+		Test_readLog();
+
+		if (!Test_isSuffix(g_Test_Count))
+		{
+			g_Test_Count--;       /* Interrupted lap is lost */
+			TEST_CHECK(Test_isSuffix(g_Test_Count));
+		}
+
+		TEST_CHECK(g_Read_Count >= before - oldestLaps);
+
+		/* New session after the power-on */
+		Test_append(laps[failWrite % TEST_POWER_FAIL_LAPS], 1);
+		Test_append(laps[(failWrite + 1) % TEST_POWER_FAIL_LAPS], 0);
+
+		Test_readLog();
+		TEST_CHECK(Test_isSuffix(g_Test_Count));
+		TEST_CHECK(g_Read_Count >= 2);
+	}
+
+	g_EepromEmu_FailHook = NULL;
+}
+
+/* Read log is a suffix of the reference ending at one of the last (LAPLOG_QUEUE_SIZE + 1) laps , Return 1 if it is */
+static uint8_t Test_isCommittedSuffix(void)
+{
+	int end;
+
+	for (end = g_Test_Count; (end >= 0) && (end >= g_Test_Count - LAPLOG_QUEUE_SIZE); end--)
+	{
+		if (Test_isSuffix(end))
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* Main loop passes with the write time : Each pass writes at most one byte and never waits for the EEPROM ,
+ * the log read between the passes is always consistent , the scan is spread over short passes and a
+ * burst of laps bigger than the queue only loses the laps that do not fit
+ */
+static void Test_nonBlocking(void)
+{
+	unsigned long writes;
+	unsigned long reads;
+	unsigned long maxReads = 0;
+	int passes = 0;
+	uint8_t idle = 0;
+	int expected;
+	int count;
+
+	Test_clear();
+
+	for (count = 0; count < 1000; count++)
+	{
+		Test_append(Test_lap(500), (count % 150) == 0);
+	}
+
+	g_EepromEmu_WriteTicks = 3;
+	g_EepromEmu_Waits = 0;
+
+	/* Power-on scan of the full log with the laps of a burst queued meanwhile */
+	LapLog_Init();
+
+	for (count = 0; count < 2 * LAPLOG_QUEUE_SIZE; count++)
+	{
+		if (count == 0)
+		{
+			LapLog_startSession();
+		}
+
+		if (count < LAPLOG_QUEUE_SIZE - 1)
+		{
+			g_Test_Laps[g_Test_Count] = Test_lap(500);
+			g_Test_Sessions[g_Test_Count] = (count == 0);
+			LapLog_append(Time_fromTicks(g_Test_Laps[g_Test_Count++]));
+		}
+		else
+		{
+			LapLog_append(Time_fromTicks(TEST_BASE_LAP));          /* Queue full --> Not logged */
+		}
+	}
+
+	expected = g_Test_Count;
+
+	/* Passes of 1 or 4 ticks (Write time 3 ticks) , a lap appended each 20 passes after the burst is written */
+	while (1)
+	{
+		writes = g_EepromEmu_Writes;
+		reads = g_EepromEmu_Reads;
+
+		if (!LapLog_process())
+		{
+			if (g_Test_Count >= expected + 200)
+			{
+				break;
+			}
+
+			idle = 1;                 /* Queued laps of the burst are written */
+		}
+
+		passes++;
+		TEST_CHECK(g_EepromEmu_Writes - writes <= 1);
+		maxReads = (g_EepromEmu_Reads - reads > maxReads) ? (g_EepromEmu_Reads - reads) : maxReads;
+
+		for (count = (passes % 2) ? 1 : 4; count > 0; count--)
+		{
+			EepromEmu_tick();
+		}
+
+		/* Export between the passes (Only when no write is in progress as in the firmware) */
+		if (LapLog_isReady() && eeprom_is_ready())
+		{
+			Test_readLog();
+			TEST_CHECK(Test_isCommittedSuffix());
+		}
+
+		if (idle && ((passes % 20) == 0) && (g_Test_Count < expected + 200))
+		{
+			g_Test_Laps[g_Test_Count] = Test_lap(500);
+			g_Test_Sessions[g_Test_Count] = 0;
+			LapLog_append(Time_fromTicks(g_Test_Laps[g_Test_Count++]));
+		}
+	}
+
+	TEST_CHECK(g_EepromEmu_Waits == 0);
+	TEST_CHECK(maxReads <= LAPLOG_HEADER_SIZE + LAPLOG_PAYLOAD_SIZE);
+
+	printf("  %d passes , max %lu EEPROM reads/pass , %lu busy waits\n", passes, maxReads, g_EepromEmu_Waits);
+
+	Test_readLog();
+	TEST_CHECK(Test_isSuffix(g_Test_Count));
+	TEST_CHECK(g_Read_Count > 200);
+
+	g_EepromEmu_WriteTicks = 0;
+}
+
+/* Encode/decode time on the host and EEPROM writes per lap */
+static void Test_throughput(void)
+{
+	LapLog_ReaderType reader;
+	Time_Type lap;
+	uint8_t session;
+	clock_t start;
+	double appendTime;
+	double readTime;
+	unsigned long reads = 0;
+	int count;
+
+	Test_clear();
+	start = clock();
+
+	for (count = 0; count < TEST_MAX_LAPS; count++)
+	{
+		Test_append(Test_lap(2000), 0);
+	}
+
+	appendTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+	start = clock();
+
+	for (count = 0; count < 100; count++)
+	{
+		LapLog_openReader(&reader);
+
+		while (LapLog_readNext(&reader, &lap, &session))
+		{
+			reads++;
+		}
+	}
+
+	readTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("  Host : %.2f us/append , %.3f us/read , %.2f EEPROM writes/lap (About %.0f ms on the AVR)\n",
+			appendTime * 1e6 / TEST_MAX_LAPS, readTime * 1e6 / reads,
+			(double)g_EepromEmu_Writes / TEST_MAX_LAPS, 8.5 * g_EepromEmu_Writes / TEST_MAX_LAPS);
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+int main(void)
+{
+	srand(32);
+
+	/* Empty log */
+	Test_clear();
+	Test_readLog();
+	TEST_CHECK(g_Read_Count == 0);
+
+	/* Extreme laps (Escape codes) and zero */
+	Test_append(0, 1);
+	Test_append(TIME_TICKS_PER_DAY - 1, 0);
+	Test_append(0, 0);
+	Test_append(1, 0);
+	Test_powerOn();
+	Test_readLog();
+	TEST_CHECK((g_Read_Count == 4) && Test_isSuffix(g_Test_Count));
+
+	Test_capacity();
+	Test_sessions();
+	Test_corruption();
+	Test_powerFailure();
+	Test_nonBlocking();
+	Test_throughput();
+
+	return TEST_RESULT("test_lap_log");
+}
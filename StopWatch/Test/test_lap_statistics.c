@@ -0,0 +1,198 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_lap_statistics.c
+ * Description: Host test of The Rolling Lap Statistics against a double precision reference.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "test.h"
+#include "Lap_Statistics.h"
+
+/*******************************************************************************
+ *                            Double Precision Reference                       *
+ *******************************************************************************/
+
+static double g_Test_Window[LAPSTAT_WINDOW_SIZE];
+static uint8_t g_Test_Count = 0;
+static uint8_t g_Test_Next = 0;
+
+static double g_Test_WorstMeanError = 0;
+static double g_Test_WorstVarianceError = 0;
+
+static void Test_reset(void)
+{
+	LapStat_reset();
+	g_Test_Count = 0;
+	g_Test_Next = 0;
+}
+
+static uint32_t Test_random32(void)
+{
+	return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+/* Add the lap to the module and the reference and compare all the statistics */
+static void Test_lap(uint32_t lap)
+{
+	double best = INFINITY;
+	double worst = -INFINITY;
+	double sum = 0;
+	double squares = 0;
+	double mean;
+	double variance;
+	double error;
+	uint8_t index;
+
+	LapStat_update(Time_fromTicks(lap));
+
+	g_Test_Window[g_Test_Next] = lap;
+	g_Test_Next = (g_Test_Next + 1) % LAPSTAT_WINDOW_SIZE;
+	g_Test_Count += (g_Test_Count < LAPSTAT_WINDOW_SIZE);
+
+	for (index = 0; index < g_Test_Count; index++)
+	{
+		best = fmin(best, g_Test_Window[index]);
+		worst = fmax(worst, g_Test_Window[index]);
+		sum += g_Test_Window[index];
+	}
+
+	mean = sum / g_Test_Count;
+
+	for (index = 0; index < g_Test_Count; index++)
+	{
+		squares += (g_Test_Window[index] - mean) * (g_Test_Window[index] - mean);
+	}
+
+	variance = squares / g_Test_Count;
+
+	TEST_CHECK(LapStat_getCount() == g_Test_Count);
+	TEST_CHECK(Time_toTicks(LapStat_getBest()) == best);
+	TEST_CHECK(Time_toTicks(LapStat_getWorst()) == worst);
+
+	error = fabs(Time_toTicks(LapStat_getMean()) - mean);
+	g_Test_WorstMeanError = fmax(g_Test_WorstMeanError, error);
+	TEST_CHECK(error < 1.0);
+
+	/* Two roundings of 1/2 and two reciprocals with a relative error of count / 2^33 */
+	error = fabs((double)LapStat_getVariance() - variance);
+	if (variance >= 1.0e6)
+	{
+		g_Test_WorstVarianceError = fmax(g_Test_WorstVarianceError, error / variance);
+	}
+
+	TEST_CHECK(error <= 1.0 + variance * 2.0 * LAPSTAT_WINDOW_SIZE / 8589934592.0);
+
+	/* Rounded square root */
+	TEST_CHECK(fabs(Time_toTicks(LapStat_getStdDev()) - sqrt(variance)) < 1.0);
+}
+
+/*******************************************************************************
+ *                                   Tests                                     *
+ *******************************************************************************/
+
+/* Consistent laps : About 90 to 100 seconds (Time ticks) */
+static void Test_consistent(void)
+{
+	uint32_t count;
+
+	Test_reset();
+
+	for (count = 0; count < 20000; count++)
+	{
+		Test_lap(58594 + (uint32_t)(rand() % 3907));
+	}
+}
+
+/* Laps spread over the whole day around the first lap of the session (Deviations up to one day) */
+static void Test_wideSpread(void)
+{
+	uint32_t reference;
+	uint32_t count;
+	uint8_t laps;
+
+	for (laps = 1; laps <= LAPSTAT_WINDOW_SIZE; laps++)
+	{
+		/* Window with (laps) entries only , then a new session */
+		for (count = 0; count < 5000; count++)
+		{
+			if (count % laps == 0)
+			{
+				Test_reset();
+			}
+
+			Test_lap(Test_random32() % TIME_TICKS_PER_DAY);
+		}
+	}
+
+	/* Full windows with the extreme laps , the first lap of the session at each end of the day */
+	for (reference = 0; reference < TIME_TICKS_PER_DAY; reference += TIME_TICKS_PER_DAY - 1)
+	{
+		Test_reset();
+		Test_lap(reference);
+
+		for (count = 0; count < 20000; count++)
+		{
+			Test_lap((rand() & 1) ? (TIME_TICKS_PER_DAY - 1 - (rand() % 4)) : (uint32_t)(rand() % 4));
+		}
+	}
+}
+
+/* Monotonic laps keep the best/worst queues at their longest */
+static void Test_monotonic(void)
+{
+	uint32_t count;
+
+	Test_reset();
+
+	for (count = 0; count < 100; count++)
+	{
+		Test_lap(100000 - count * 37);
+	}
+
+	for (count = 0; count < 100; count++)
+	{
+		Test_lap(90000 + count * 41);
+	}
+}
+
+/* A one second session then day long laps : Exact best , worst and mean (No clamp of the deviations) */
+static void Test_dayLaps(void)
+{
+	Test_reset();
+
+	LapStat_update(Time_fromTicks(TIME_TICKS_PER_SECOND));
+	LapStat_update(Time_fromTicks(TIME_TICKS_PER_DAY - 1));
+	LapStat_update(Time_fromTicks(TIME_TICKS_PER_DAY - 1));
+	LapStat_update(Time_fromTicks(TIME_TICKS_PER_DAY - 1));
+
+	TEST_CHECK(Time_toTicks(LapStat_getWorst()) == TIME_TICKS_PER_DAY - 1);
+	TEST_CHECK(Time_toTicks(LapStat_getBest()) == TIME_TICKS_PER_SECOND);
+	TEST_CHECK(Time_toTicks(LapStat_getMean()) ==
+			(TIME_TICKS_PER_SECOND + 3 * (TIME_TICKS_PER_DAY - 1) + 2) / 4);
+
+	/* Standard deviation of one lap apart from three : sqrt(3) / 4 of the difference */
+	TEST_CHECK(fabs(Time_toTicks(LapStat_getStdDev()) - sqrt(3.0) / 4.0 * (TIME_TICKS_PER_DAY - 1 - TIME_TICKS_PER_SECOND))
+			< 1.0);
+
+	Test_reset();
+	TEST_CHECK((LapStat_getCount() == 0) && (Time_toTicks(LapStat_getBest()) == 0) && (Time_toTicks(LapStat_getMean()) == 0));
+	TEST_CHECK(LapStat_getVariance() == 0);
+}
+
+int main(void)
+{
+	srand(28);
+
+	Test_consistent();
+	Test_wideSpread();
+	Test_monotonic();
+	Test_dayLaps();
+
+	printf("  Worst mean error %.3f ticks , worst variance error %.2e relative (variance >= 1e6)\n",
+			g_Test_WorstMeanError, g_Test_WorstVarianceError);
+
+	return TEST_RESULT("test_lap_statistics");
+}
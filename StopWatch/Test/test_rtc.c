@@ -0,0 +1,251 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_rtc.c
+ * Description: Host simulation of The Timer1 trim against the Timer2 watch crystal
+ *              with injected main clock error profiles.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "timer1_sim.h"
+#include "RTC.h"
+#include "Elapsed_Time.h"
+
+void TIMER2_OVF_vect(void);
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define TEST_TIMER1_HZ         (F_CPU / 1024.0)
+#define TEST_RUN_SECONDS       7200
+
+/* Drift is checked from this crystal second (The untrimmed start takes two windows) */
+#define TEST_SETTLE_SECONDS    (3 * RTC_WINDOW_SECONDS)
+
+/* Lap between two gate edges at these crystal seconds (Scaled by the window measured at its end) */
+#define TEST_LAP_START         3000
+#define TEST_LAP_SECONDS       600
+
+/* Main clock error (Relative , 0.01 --> 1% fast) at the time t (in seconds) */
+typedef double (*Test_ProfileType)(double t);
+
+typedef struct
+{
+	const char *name;
+	Test_ProfileType error;
+	double bound;              /* Allowed residual drift after the settling time (in seconds) */
+	double lapBound;           /* Allowed lap error (in seconds) */
+
+}Test_CaseType;
+
+/*******************************************************************************
+ *                           Oscillator Error Profiles                         *
+ *******************************************************************************/
+
+static double Test_fast(double t)   { (void)t; return 0.02; }
+static double Test_slow(double t)   { (void)t; return -0.03; }
+static double Test_nominal(double t){ (void)t; return 0.0; }
+
+/* Temperature cycle : 1% +/- 0.5% with a 10 minutes period */
+static double Test_cycle(double t)  { return 0.01 + 0.005 * sin(2.0 * M_PI * t / 600.0); }
+
+/* Warm up : 0% --> 2% linearly over the 2 hours */
+static double Test_ramp(double t)   { return 0.02 * t / TEST_RUN_SECONDS; }
+
+/* Supply step : +1% then -1% after 30 minutes */
+static double Test_step(double t)   { return (t < 1800.0) ? 0.01 : -0.01; }
+
+/*******************************************************************************
+ *                                 Simulation                                  *
+ *******************************************************************************/
+
+static uint32_t g_Test_Seconds = 0;     /* Stop-Watch seconds (Compare A interrupts) */
+static uint32_t g_Test_LapTicks = 0;    /* Timer1 ticks of the test lap */
+static uint32_t g_Test_LapScale = 0;    /* Scale of the test lap as the Stop Watch with RTC_TRIM_MODE = 1 */
+
+/* Same work as the Stop Watch Compare A (ISR) with RTC_TRIM_MODE = 1 */
+static void Test_compareIsr(void)
+{
+	g_Test_Seconds++;
+	ICU_timerPeriodElapsed();
+	OCR1A = RTC_getTrimmedCompareValue();
+}
+
+/* Timer1 clock is stopped */
+static uint8_t Test_isPaused(void)
+{
+	return ((TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10))) == 0);
+}
+
+/* Stop-Watch time minus the crystal time (in seconds) */
+static double Test_drift(uint32_t crystalSeconds)
+{
+	return (double)g_Test_Seconds + ((double)TCNT1 / (OCR1A + 1)) - crystalSeconds;
+}
+
+/* Run one error profile and return the largest residual drift after the settling time
+ * The Timer2 (ISR) is served up to 3 Timer1 ticks late (Other interrupts running).
+ */
+static double Test_run(Test_ProfileType error, uint32_t seconds, uint32_t pauseAt, double *untrimmed)
+{
+	double nextTick = 0.0;
+	double settleDrift = 0.0;
+	double worst = 0.0;
+	double drift;
+	double integral = 0.0;
+	uint32_t crystal = 0;
+	uint32_t paused = 0;       /* Crystal seconds while the Stop-Watch is paused */
+	uint8_t late = 0;
+	uint8_t pending = 0;
+
+	Timer1Sim_reset();
+	g_Test_Seconds = 0;
+	OCR1A = 977;
+	TCCR1B = (1 << WGM12) | (1 << CS12) | (1 << CS10);
+
+	RTC_Init(0);
+
+	while (crystal < seconds)
+	{
+		nextTick += 1.0 / (TEST_TIMER1_HZ * (1.0 + error(nextTick)));
+
+		/* Crystal seconds before the next Timer1 tick */
+		while ((double)(crystal + 1) <= nextTick)
+		{
+			crystal++;
+			pending = 1;
+			late = (uint8_t)(rand() % 4);
+
+			integral += error(crystal);
+
+			/* Pause for 20 seconds : The windows with paused time must be discarded */
+			if (crystal == pauseAt)
+			{
+				TCCR1B &= ~((1 << CS12) | (1 << CS11) | (1 << CS10));
+				RTC_restartEstimation();
+			}
+			else if (pauseAt && (crystal == pauseAt + 20))
+			{
+				TCCR1B |= (1 << CS12) | (1 << CS10);
+				RTC_restartEstimation();
+			}
+
+			if (Test_isPaused())
+			{
+				paused++;               /* The paused time is not a clock error */
+			}
+			else if (crystal == TEST_SETTLE_SECONDS)
+			{
+				settleDrift = Test_drift(crystal - paused);
+			}
+			else if (crystal > TEST_SETTLE_SECONDS)
+			{
+				drift = fabs(Test_drift(crystal - paused) - settleDrift);
+				worst = (drift > worst) ? drift : worst;
+			}
+
+			/* Gate edges of the test lap */
+			if (crystal == TEST_LAP_START)
+			{
+				g_Test_LapTicks = ICU_getTimestamp();
+			}
+			else if (crystal == TEST_LAP_START + TEST_LAP_SECONDS)
+			{
+				g_Test_LapTicks = ICU_getTimestamp() - g_Test_LapTicks;
+				g_Test_LapScale = Time_timer1Scale(RTC_getWindowTicks());
+			}
+		}
+
+		Timer1Sim_tick();
+		Timer1Sim_serveCompare(Test_compareIsr);
+
+		if (pending && (late-- == 0))
+		{
+			pending = 0;
+			TIMER2_OVF_vect();
+		}
+	}
+
+	/* Drift of the untrimmed 977 compare value with the same profile */
+	*untrimmed = integral - seconds * (978.0 / TEST_TIMER1_HZ - 1.0);
+
+	return worst;
+}
+
+int main(void)
+{
+	/* Bound : a constant error is cancelled to the tick quantization (Windows are back to back
+	 * so the rounding of each window is given back by the next one). A changing error is applied
+	 * one to two windows (16 --> 32 s) late , so the residual drift is about the error change
+	 * in 24 s integrated over the run : 2 x 0.5% x 24 s for the cycle (Peak to peak) ,
+	 * 2% / 7200 s x 24 s x 7200 s for the ramp and 2% x 32 s for the step.
+	 * Lap bound : the lap is scaled by the last window , a constant error is measured to 3 ticks
+	 * (Late Timer2 (ISR)) in 15625 : 192 ppm x 600 s. A changing error is the one of the last
+	 * window instead of the lap average : 0.5% x 600 s for the cycle (Worst phase) and
+	 * 2% / 7200 s x (300 + 24) s x 600 s for the ramp (The step is constant during the lap).
+	 */
+	static const Test_CaseType cases[] =
+	{
+		{"nominal clock",        Test_nominal, 0.010, 0.120},
+		{"2% fast",              Test_fast,    0.010, 0.120},
+		{"3% slow",              Test_slow,    0.010, 0.120},
+		{"1% +/- 0.5% cycle",    Test_cycle,   0.250, 3.000},
+		{"0 --> 2% ramp",        Test_ramp,    0.500, 0.540},
+		{"+1% --> -1% step",     Test_step,    0.640, 0.120},
+	};
+	double residual;
+	double untrimmed;
+	double lapError;
+	double lapUntrimmed;
+	int32_t ppm;
+	uint32_t windowTicks;
+	uint8_t index;
+
+	srand(27);
+
+	for (index = 0; index < sizeof(cases) / sizeof(cases[0]); index++)
+	{
+		residual = Test_run(cases[index].error, TEST_RUN_SECONDS, 0, &untrimmed);
+
+		printf("  %-20s residual drift %7.3f s (bound %5.3f s) , untrimmed %8.2f s over %d s\n",
+				cases[index].name, residual, cases[index].bound, fabs(untrimmed), TEST_RUN_SECONDS);
+
+		TEST_CHECK(residual < cases[index].bound);
+
+		/* The same lap with the measured and the nominal Timer1 rate */
+		lapError = (double)Time_toTicks(Time_fromTimer1Ticks(g_Test_LapTicks, g_Test_LapScale)) / TIME_TICKS_PER_SECOND
+				- TEST_LAP_SECONDS;
+		lapUntrimmed = (double)Time_toTicks(Time_fromTimer1Ticks(g_Test_LapTicks, TIME_TIMER1_NOMINAL_SCALE))
+				/ TIME_TICKS_PER_SECOND - TEST_LAP_SECONDS;
+
+		printf("  %-20s lap error      %7.3f s (bound %5.3f s) , untrimmed %8.2f s over %d s\n",
+				"", fabs(lapError), cases[index].lapBound, fabs(lapUntrimmed), TEST_LAP_SECONDS);
+
+		TEST_CHECK(fabs(lapError) < cases[index].lapBound);
+	}
+
+	/* Measured error in ppm (One tick in a window is 64 ppm) */
+	Test_run(Test_fast, 200, 0, &untrimmed);
+	ppm = RTC_getClockErrorPpm();
+	TEST_CHECK((ppm > 20000 - 64) && (ppm < 20000 + 64));
+
+	/* A pause discards the window , the trim is not disturbed */
+	residual = Test_run(Test_slow, 600, 300, &untrimmed);
+	TEST_CHECK(residual < 0.010);
+
+	/* Warm restart : The saved measurement is used at once , an invalid one is ignored */
+	windowTicks = RTC_getWindowTicks();
+	RTC_Init(0);
+	TEST_CHECK(RTC_getWindowTicks() == ((uint32_t)OCR1A + 1) << RTC_WINDOW_SHIFT);
+	RTC_Init(windowTicks);
+	TEST_CHECK(RTC_getWindowTicks() == windowTicks);
+	RTC_Init(0xFFFFFFFFUL);
+	TEST_CHECK(RTC_getWindowTicks() != 0xFFFFFFFFUL);
+
+	return TEST_RESULT("test_rtc");
+}
@@ -0,0 +1,779 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_serial_command.c
+ * Description: Loopback test of The Serial Commands : The whole firmware runs its main loop while the test
+ *              plays the PC at the other end of the UART wire (Commands , responses , display pages ,
+ *              throughput and latency , LAP streams with the EEPROM write time).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+/* The firmware main() is built as StopWatch_main() (-Dmain=StopWatch_main) */
+#undef main
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "timer1_sim.h"
+#include "eeprom_emu.h"
+#include "StopWatch.h"
+#include "Serial_Command.h"
+#include "Lap_Statistics.h"
+#include "uart.h"
+#include "crc8.h"
+#include "Elapsed_Time.h"
+#include <util/delay.h>
+#include <avr/wdt.h>
+
+int StopWatch_main(void);
+void TIMER1_COMPA_vect(void);
+void TIMER1_CAPT_vect(void);
+void USART_RXC_vect(void);
+void USART_UDRE_vect(void);
+
+#define TEST_PERIOD_TICKS      978UL      /* Timer1 ticks in one second (OCR1A + 1) */
+#define TEST_TICK_US           1024UL     /* F_CPU/1024 tick of Timer0 and Timer1 */
+#define TEST_TIMEOUT_TICKS     5000       /* A response must come in about 5 seconds */
+#define TEST_BLOCKED_SECONDS   20         /* Real time limit (The firmware busy waiting for the UART never returns) */
+#define TEST_PIPELINED         2000       /* Commands of the throughput test */
+#define TEST_IN_FLIGHT         4          /* Commands sent before their responses are received */
+#define TEST_LAPS              8          /* More LOG_LAP frames than the TX buffer can hold */
+#define TEST_EEPROM_WRITE      9          /* EEPROM write time in ticks (8.5ms) */
+#define TEST_WDT_TICKS         508        /* Watchdog timeout in ticks (520ms) */
+#define TEST_LAP_BURST         15         /* LAP frames sent back to back (60 bytes , the RX buffer holds them) */
+#define TEST_STREAM_TICKS      5000       /* Length of the sustained LAP stream */
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Frame received by the PC */
+typedef struct
+{
+	uint8_t command;
+	uint8_t length;
+	uint8_t payload[SERIALCMD_MAX_RESPONSE];
+	uint32_t tick;            /* Tick of its last byte */
+
+}Test_FrameType;
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+/* The firmware runs in its own context , the test (PC side) gives it a number of ticks then gets the control back */
+static ucontext_t g_Test_PcContext;
+static ucontext_t g_Test_FirmwareContext;
+static uint8_t g_Test_FirmwareStack[256 * 1024];
+static long g_Test_TicksLeft = 0;
+
+static uint32_t g_Test_Now = 0;           /* Ticks since the power on */
+static uint32_t g_Test_Passes = 0;        /* Main loop passes */
+static uint8_t g_Test_TxLine = 1;         /* 0 --> The PC does not read (The UART TX is stopped) */
+
+/* Longest time without a watchdog feed and between two display refresh slots */
+static uint32_t g_Test_LastFeed = 0;
+static uint32_t g_Test_MaxFeedGap = 0;
+static uint32_t g_Test_LastSlot = 0;
+static uint32_t g_Test_MaxSlotGap = 0;
+static uint8_t g_Test_Shown[TIME_BCD_DIGITS];   /* Last value lit on each 7-Segment */
+
+/* PC --> MC bytes on the wire */
+static uint8_t g_Pc_TxBytes[1024];
+static uint16_t g_Pc_TxHead = 0;
+static uint16_t g_Pc_TxTail = 0;
+static uint32_t g_Pc_LastSentTick = 0;    /* Tick of the last byte received by the MC */
+
+/* MC --> PC frames (Parsed from the received bytes) */
+static Test_FrameType g_Pc_Frames[64];
+static uint8_t g_Pc_FrameHead = 0;
+static uint8_t g_Pc_FrameTail = 0;
+static uint8_t g_Pc_RxBytes[SERIALCMD_OVERHEAD + SERIALCMD_MAX_RESPONSE];
+static uint8_t g_Pc_RxCount = 0;
+static uint32_t g_Pc_RxTotal = 0;         /* Bytes received by the PC */
+
+/*******************************************************************************
+ *                                PC Side Model                                *
+ *******************************************************************************/
+
+static void Test_pcReceive(uint8_t data)
+{
+	Test_FrameType *frame;
+	uint8_t crc = CRC8_INITIAL_VALUE;
+	uint8_t count;
+
+	g_Pc_RxTotal++;
+
+	/* The firmware sends only whole and valid frames , so nothing is skipped */
+	TEST_CHECK((g_Pc_RxCount != 0) || (data == SERIALCMD_SYNC));
+	TEST_CHECK((g_Pc_RxCount != 2) || (data <= SERIALCMD_MAX_RESPONSE));
+
+	g_Pc_RxBytes[g_Pc_RxCount++] = data;
+
+	if ((g_Pc_RxCount < 3) || (g_Pc_RxCount < g_Pc_RxBytes[2] + SERIALCMD_OVERHEAD))
+	{
+		return;
+	}
+
+	for (count = 1; count < g_Pc_RxCount - 1; count++)
+	{
+		crc = CRC8_update(crc, g_Pc_RxBytes[count]);
+	}
+
+	TEST_CHECK(crc == data);
+
+	frame = &g_Pc_Frames[g_Pc_FrameHead];
+	frame->command = g_Pc_RxBytes[1];
+	frame->length = g_Pc_RxBytes[2];
+	memcpy(frame->payload, &g_Pc_RxBytes[3], frame->length);
+	frame->tick = g_Test_Now;
+
+	g_Pc_FrameHead = (g_Pc_FrameHead + 1) % 64;
+	TEST_CHECK(g_Pc_FrameHead != g_Pc_FrameTail);
+	g_Pc_RxCount = 0;
+}
+
+static void Test_pcSendBytes(const uint8_t *data, uint8_t count)
+{
+	while (count--)
+	{
+		g_Pc_TxBytes[g_Pc_TxHead] = *data++;
+		g_Pc_TxHead = (g_Pc_TxHead + 1) % sizeof(g_Pc_TxBytes);
+	}
+}
+
+static void Test_pcSend(uint8_t command, const uint8_t *payload, uint8_t length)
+{
+	uint8_t frame[SERIALCMD_OVERHEAD + SERIALCMD_MAX_PAYLOAD];
+	uint8_t count;
+
+	frame[0] = SERIALCMD_SYNC;
+	frame[1] = command;
+	frame[2] = length;
+	memcpy(&frame[3], payload, length);
+	frame[length + 3] = CRC8_INITIAL_VALUE;
+
+	for (count = 1; count < length + 3; count++)
+	{
+		frame[length + 3] = CRC8_update(frame[length + 3], frame[count]);
+	}
+
+	Test_pcSendBytes(frame, length + SERIALCMD_OVERHEAD);
+}
+
+static uint8_t Test_pcSent(void)
+{
+	return (g_Pc_TxHead == g_Pc_TxTail);
+}
+
+static uint8_t Test_pcFrames(void)
+{
+	return (uint8_t)(g_Pc_FrameHead - g_Pc_FrameTail) % 64;
+}
+
+/*******************************************************************************
+ *                              Firmware Side Model                            *
+ *******************************************************************************/
+
+/* One F_CPU/1024 tick : Timer0 , Timer1 and one byte in each direction of the wire
+ * (10 bits at 9600 baud take 1.04ms) , the (ISR)s are served when the interrupts are enabled
+ */
+static void Test_tick(void)
+{
+	Timer1Sim_tick();
+	EepromEmu_tick();
+	TCNT0++;
+	g_Test_Now++;
+
+	if (BIT_IS_CLEAR(SREG, I_BIT))
+	{
+		return;
+	}
+
+	Timer1Sim_serveCapture(TIMER1_CAPT_vect);
+	Timer1Sim_serveCompare(TIMER1_COMPA_vect);
+
+	if (g_Pc_TxHead != g_Pc_TxTail)
+	{
+		UDR = g_Pc_TxBytes[g_Pc_TxTail];
+		g_Pc_TxTail = (g_Pc_TxTail + 1) % sizeof(g_Pc_TxBytes);
+		g_Pc_LastSentTick = g_Test_Now;
+		USART_RXC_vect();
+	}
+
+	if (g_Test_TxLine && BIT_IS_SET(UCSRB, UDRIE))
+	{
+		USART_UDRE_vect();
+
+		if (BIT_IS_SET(UCSRB, UDRIE))
+		{
+			Test_pcReceive(UDR);     /* Still enabled --> A byte is sent */
+		}
+	}
+}
+
+/* Run ticks of the firmware , the PC gets the control back when the ticks given are run */
+static void Test_run(uint8_t ticks)
+{
+	g_Test_TicksLeft -= ticks;
+
+	while (ticks--)
+	{
+		Test_tick();
+	}
+
+	if (g_Test_TicksLeft <= 0)
+	{
+		swapcontext(&g_Test_FirmwareContext, &g_Test_PcContext);
+	}
+}
+
+/* Each 4ms slot of the display refresh (A digit is lit until the next slot) */
+static void Test_refreshSlot(void)
+{
+	uint8_t position;
+
+	if (g_Test_Now - g_Test_LastSlot > g_Test_MaxSlotGap)
+	{
+		g_Test_MaxSlotGap = g_Test_Now - g_Test_LastSlot;
+	}
+
+	for (position = 0; position < TIME_BCD_DIGITS; position++)
+	{
+		if (PORTA == (1 << position))
+		{
+			g_Test_Shown[position] = PORTC & 0x0F;
+		}
+	}
+
+	Test_run(4);
+	g_Test_LastSlot = g_Test_Now;
+}
+
+/* Busy wait of the firmware for the EEPROM write in progress */
+static void Test_eepromWait(void)
+{
+	Test_run(1);
+}
+
+static void Test_mainLoopPass(void)
+{
+	if (g_Test_Now - g_Test_LastFeed > g_Test_MaxFeedGap)
+	{
+		g_Test_MaxFeedGap = g_Test_Now - g_Test_LastFeed;
+	}
+
+	g_Test_LastFeed = g_Test_Now;
+	g_Test_Passes++;
+}
+
+static void Test_firmware(void)
+{
+	StopWatch_main();
+}
+
+/* Firmware blocked in a busy wait (It never reaches a display refresh slot) */
+static void Test_blocked(int signal)
+{
+	(void)signal;
+
+	printf("test_serial_command: the firmware is blocked after %lu ticks\n", (unsigned long)g_Test_Now);
+	fflush(stdout);
+	_exit(1);
+}
+
+/*******************************************************************************
+ *                                  PC Script                                  *
+ *******************************************************************************/
+
+/* Let the firmware run for some ticks */
+static void Test_wait(long ticks)
+{
+	g_Test_TicksLeft = ticks;
+	swapcontext(&g_Test_PcContext, &g_Test_FirmwareContext);
+}
+
+/* Wait for the next frame from the MC (Return 0 on a timeout) */
+static uint8_t Test_receive(Test_FrameType *frame)
+{
+	uint32_t start = g_Test_Now;
+
+	while (Test_pcFrames() == 0)
+	{
+		if (g_Test_Now - start > TEST_TIMEOUT_TICKS)
+		{
+			return 0;
+		}
+
+		Test_wait(1);
+	}
+
+	*frame = g_Pc_Frames[g_Pc_FrameTail];
+	g_Pc_FrameTail = (g_Pc_FrameTail + 1) % 64;
+
+	return 1;
+}
+
+/* Send a command and check its response header (Status and payload length) */
+static void Test_command(uint8_t command, const uint8_t *payload, uint8_t length,
+		uint8_t status, uint8_t responseLength, Test_FrameType *response)
+{
+	Test_pcSend(command, payload, length);
+
+	TEST_CHECK(Test_receive(response));
+	TEST_CHECK(response->command == (command | SERIALCMD_RESPONSE_FLAG));
+	TEST_CHECK(response->length == responseLength);
+	TEST_CHECK(response->payload[0] == status);
+}
+
+static uint32_t Test_getUint32(const uint8_t *payload)
+{
+	return payload[0] | ((uint32_t)payload[1] << 8) | ((uint32_t)payload[2] << 16) | ((uint32_t)payload[3] << 24);
+}
+
+static uint32_t Test_statusSeconds(const Test_FrameType *status)
+{
+	return (status->payload[1] * 60UL + status->payload[2]) * 60UL + status->payload[3];
+}
+
+/* Each command and each error case of the protocol */
+static void Test_commands(void)
+{
+	static const uint8_t preset[3] = {1, 2, 3};
+	static const uint8_t badPreset[3] = {24, 0, 0};
+	static const uint8_t garbage[8] = {0x00, SERIALCMD_SYNC, 0xFF, 0x20, 0x7E, SERIALCMD_SYNC, 0x01, 0x30};
+	Test_FrameType response;
+	uint8_t broken[SERIALCMD_OVERHEAD];
+
+	Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+	TEST_CHECK(Test_statusSeconds(&response) <= 1);
+	TEST_CHECK(response.payload[4] == 0);
+
+	Test_command(SERIALCMD_PAUSE, NULL, 0, SERIALCMD_OK, 1, &response);
+	Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+	TEST_CHECK(response.payload[4] == 1);
+
+	Test_command(SERIALCMD_RESUME, NULL, 0, SERIALCMD_OK, 1, &response);
+	Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+	TEST_CHECK(response.payload[4] == 0);
+
+	/* PRESET : The time continues from the preset */
+	Test_command(SERIALCMD_PRESET, preset, 3, SERIALCMD_OK, 1, &response);
+	Test_wait(3 * TEST_PERIOD_TICKS + TEST_PERIOD_TICKS / 2);    /* Middle of a second (The seconds are counted by the main loop) */
+	Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+	TEST_CHECK(Test_statusSeconds(&response) == 3723 + 3);
+
+	Test_command(SERIALCMD_PRESET, badPreset, 3, SERIALCMD_BAD_PAYLOAD, 1, &response);
+	Test_command(SERIALCMD_PRESET, preset, 2, SERIALCMD_BAD_PAYLOAD, 1, &response);
+	Test_command(0x33, NULL, 0, SERIALCMD_UNKNOWN, 1, &response);
+
+	/* Frame with a wrong CRC and bytes that can not start a frame are dropped without a response */
+	broken[0] = SERIALCMD_SYNC;
+	broken[1] = SERIALCMD_RESET;
+	broken[2] = 0;
+	broken[3] = CRC8_update(CRC8_update(CRC8_INITIAL_VALUE, SERIALCMD_RESET), 0) ^ 0x10;
+	Test_pcSendBytes(broken, SERIALCMD_OVERHEAD);
+	Test_pcSendBytes(garbage, sizeof(garbage));
+	Test_wait(200);
+	TEST_CHECK(Test_pcFrames() == 0);
+
+	/* The SYNC bytes of the garbage (Wrong lengths) are dropped one by one , the next frame is still found */
+	Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+	TEST_CHECK(Test_statusSeconds(&response) >= 3723 + 3);   /* RESET was not executed */
+}
+
+/* LAP commands end the laps when their frames are received , also across a PRESET (Timer1 restarted) ,
+ * then the statistics and the exported log have the exact laps (Timer1 ticks between the frames in time ticks)
+ */
+static void Test_laps(void)
+{
+	static const uint8_t preset[3] = {10, 0, 0};
+	Test_FrameType response;
+	uint32_t gates[TEST_LAPS + 1];
+	uint32_t laps[TEST_LAPS];
+	uint32_t best = 0xFFFFFFFF;
+	uint32_t worst = 0;
+	uint8_t count;
+	uint8_t exported = 0;
+	uint8_t busy = 0;
+
+	Test_command(SERIALCMD_RESET, NULL, 0, SERIALCMD_OK, 1, &response);
+
+	for (count = 0; count <= TEST_LAPS; count++)
+	{
+		Test_wait(300 + rand() % 1500);
+
+		if (count == TEST_LAPS / 2)
+		{
+			Test_command(SERIALCMD_PRESET, preset, 3, SERIALCMD_OK, 1, &response);
+			Test_wait(rand() % 1000);
+		}
+
+		Test_command(SERIALCMD_LAP, NULL, 0, SERIALCMD_OK, 1, &response);
+		gates[count] = g_Pc_LastSentTick;
+	}
+
+	for (count = 0; count < TEST_LAPS; count++)
+	{
+		laps[count] = Time_toTicks(Time_fromTimer1Ticks(gates[count + 1] - gates[count], TIME_TIMER1_NOMINAL_SCALE));
+		best = (laps[count] < best) ? laps[count] : best;
+		worst = (laps[count] > worst) ? laps[count] : worst;
+	}
+
+	Test_command(SERIALCMD_STATS, NULL, 0, SERIALCMD_OK, 18, &response);
+	TEST_CHECK(response.payload[1] == TEST_LAPS);
+	TEST_CHECK(Test_getUint32(&response.payload[2]) == best);
+	TEST_CHECK(Test_getUint32(&response.payload[6]) == worst);
+
+	/* Log export : The laps of the session then an empty LOG_LAP frame , the TX is stopped so the export is
+	 * not finished when the second EXPORT_LOG is executed (BUSY , its response is between the LOG_LAP frames)
+	 */
+	Test_wait(500);                /* The last lap is written in the EEPROM by the next main loop passes */
+	g_Test_TxLine = 0;
+	Test_pcSend(SERIALCMD_EXPORT_LOG, NULL, 0);
+	Test_pcSend(SERIALCMD_EXPORT_LOG, NULL, 0);
+	Test_wait(100);
+	g_Test_TxLine = 1;
+
+	TEST_CHECK(Test_receive(&response) && (response.command == (SERIALCMD_EXPORT_LOG | SERIALCMD_RESPONSE_FLAG)));
+	TEST_CHECK(response.payload[0] == SERIALCMD_OK);
+
+	while (Test_receive(&response))
+	{
+		if (response.command == (SERIALCMD_EXPORT_LOG | SERIALCMD_RESPONSE_FLAG))
+		{
+			TEST_CHECK(response.payload[0] == SERIALCMD_BUSY);
+			busy++;
+			continue;
+		}
+
+		TEST_CHECK(response.command == (SERIALCMD_LOG_LAP | SERIALCMD_RESPONSE_FLAG));
+
+		if (response.length == 0)
+		{
+			break;                /* End of the log */
+		}
+
+		TEST_CHECK(response.length == 5);
+		TEST_CHECK((exported < TEST_LAPS) && (Test_getUint32(&response.payload[1]) == laps[exported]));
+		TEST_CHECK(response.payload[0] == (exported == 0));
+		exported++;
+	}
+
+	TEST_CHECK(exported == TEST_LAPS);
+	TEST_CHECK(busy == 1);
+}
+
+/* The digits lit on the display are the required ones */
+static uint8_t Test_isShown(const uint8_t *digits)
+{
+	return (memcmp(g_Test_Shown, digits, TIME_BCD_DIGITS) == 0);
+}
+
+/* DISPLAY pages : Each lap statistic of the STATS response (MM:SS and hundredths) , updated by a new lap ,
+ * then the time page again (Paused so the time does not change , the digits blink)
+ */
+static void Test_displayPages(void)
+{
+	static const uint8_t timePage[1] = {STOPWATCH_PAGE_TIME};
+	static const uint8_t badPage[1] = {STOPWATCH_PAGE_STDDEV + 1};
+	Test_FrameType response;
+	Test_FrameType stats;
+	uint8_t digits[TIME_BCD_DIGITS];
+	uint8_t page;
+
+	Test_command(SERIALCMD_STATS, NULL, 0, SERIALCMD_OK, 18, &stats);
+	TEST_CHECK(stats.payload[1] > 1);
+
+	for (page = STOPWATCH_PAGE_BEST; page <= STOPWATCH_PAGE_STDDEV; page++)
+	{
+		Test_command(SERIALCMD_DISPLAY, &page, 1, SERIALCMD_OK, 1, &response);
+		Test_wait(50);
+
+		Time_toLapBCD(Time_fromTicks(Test_getUint32(&stats.payload[2 + 4 * (page - STOPWATCH_PAGE_BEST)])), digits);
+		TEST_CHECK(Test_isShown(digits));
+	}
+
+	/* The mean page follows the next lap */
+	page = STOPWATCH_PAGE_MEAN;
+	Test_command(SERIALCMD_DISPLAY, &page, 1, SERIALCMD_OK, 1, &response);
+	Test_wait(3000);
+	Test_command(SERIALCMD_LAP, NULL, 0, SERIALCMD_OK, 1, &response);
+	Test_wait(50);
+	Test_command(SERIALCMD_STATS, NULL, 0, SERIALCMD_OK, 18, &stats);
+	Time_toLapBCD(Time_fromTicks(Test_getUint32(&stats.payload[10])), digits);
+	TEST_CHECK(Test_isShown(digits));
+
+	Test_command(SERIALCMD_DISPLAY, badPage, 1, SERIALCMD_BAD_PAYLOAD, 1, &response);
+	Test_command(SERIALCMD_DISPLAY, NULL, 0, SERIALCMD_BAD_PAYLOAD, 1, &response);
+	TEST_CHECK(Test_isShown(digits));
+
+	Test_command(SERIALCMD_PAUSE, NULL, 0, SERIALCMD_OK, 1, &response);
+	Test_command(SERIALCMD_DISPLAY, timePage, 1, SERIALCMD_OK, 1, &response);
+	Test_wait(1200);
+	Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+	Time_toBCD(Time_fromTicks(Test_statusSeconds(&response) << TIME_TICK_SHIFT), digits);
+	TEST_CHECK(Test_isShown(digits));
+	Test_command(SERIALCMD_RESUME, NULL, 0, SERIALCMD_OK, 1, &response);
+}
+
+/* Light gate edge now (Its capture (ISR) is served by the next tick) , Return its Timer1 tick */
+static uint32_t Test_gateEdge(void)
+{
+	Timer1Sim_capture();
+
+	return g_Test_Now;
+}
+
+/* Laps count and best lap of the STATS response */
+static void Test_stats(uint8_t *count, uint32_t *best)
+{
+	Test_FrameType response;
+
+	Test_command(SERIALCMD_STATS, NULL, 0, SERIALCMD_OK, 18, &response);
+	*count = response.payload[1];
+	*best = Test_getUint32(&response.payload[2]);
+}
+
+/* RESET button (INT0 (ISR) at an arbitrary point of the main loop) : The time and the laps restart from zero ,
+ * a gate edge queued before the RESET never ends or starts a lap of the new session
+ */
+static void Test_resetButton(void)
+{
+	Test_FrameType response;
+	uint32_t first;
+	uint8_t count;
+	uint32_t best;
+	uint8_t round;
+
+	for (round = 0; round < 20; round++)
+	{
+		Test_wait(rand() % 50);
+		resetDigits();
+		Test_wait(100);
+
+		Test_command(SERIALCMD_STATUS, NULL, 0, SERIALCMD_OK, 9, &response);
+		TEST_CHECK(Test_statusSeconds(&response) <= 1);   /* The current Timer1 second continues */
+		Test_stats(&count, &best);
+		TEST_CHECK(count == 0);
+
+		/* One lap , then an edge and the RESET at the same time (The edge is still in the capture queue) */
+		first = Test_gateEdge();
+		Test_wait(300 + rand() % 300);
+		best = Test_gateEdge() - first;
+		Test_wait(100);
+		Test_stats(&count, &first);
+		TEST_CHECK((count == 1) && (first == Time_toTicks(Time_fromTimer1Ticks(best, TIME_TIMER1_NOMINAL_SCALE))));
+
+		Test_wait(rand() % 30);
+		Test_gateEdge();
+		resetDigits();
+		Test_wait(100);
+
+		Test_stats(&count, &best);
+		TEST_CHECK(count == 0);
+
+		/* First lap of the new session is between its own two edges */
+		first = Test_gateEdge();
+		Test_wait(700 + rand() % 300);
+		best = Test_gateEdge() - first;
+		Test_wait(100);
+		Test_stats(&count, &first);
+		TEST_CHECK((count == 1) && (first == Time_toTicks(Time_fromTimer1Ticks(best, TIME_TIMER1_NOMINAL_SCALE))));
+	}
+}
+
+/* PC stops reading : The TX buffer fills , the next frames wait in the RX buffer while the main loop
+ * continues and they are all answered in order when the PC reads again
+ */
+static void Test_txFull(void)
+{
+	Test_FrameType response;
+	uint32_t passes;
+	uint8_t count;
+
+	g_Test_TxLine = 0;
+	passes = g_Test_Passes;
+
+	for (count = 0; count < 5; count++)
+	{
+		Test_pcSend(SERIALCMD_STATS, NULL, 0);
+	}
+
+	Test_pcSend(SERIALCMD_STATUS, NULL, 0);
+	Test_wait(2000);
+
+	TEST_CHECK(g_Test_Passes - passes > 50);     /* Main loop is not blocked by the full TX buffer */
+	TEST_CHECK(UART_available() != 0);           /* Frames without space for their response are kept */
+	TEST_CHECK(UART_txFree() < SERIALCMD_OVERHEAD + SERIALCMD_MAX_RESPONSE);
+
+	g_Test_TxLine = 1;
+
+	for (count = 0; count < 5; count++)
+	{
+		TEST_CHECK(Test_receive(&response) && (response.command == (SERIALCMD_STATS | SERIALCMD_RESPONSE_FLAG)));
+	}
+
+	TEST_CHECK(Test_receive(&response) && (response.command == (SERIALCMD_STATUS | SERIALCMD_RESPONSE_FLAG)));
+	TEST_CHECK(UART_available() == 0);
+}
+
+/* LAP frames with the EEPROM write time : A burst filling the RX buffer then a sustained stream (The PC
+ * keeps TEST_IN_FLIGHT LAP frames in flight) , the watchdog is fed and the display refreshed all along ,
+ * nothing waits for the EEPROM and every LAP is answered in order and counted in the statistics
+ */
+static void Test_lapStream(void)
+{
+	Test_FrameType response;
+	uint32_t start;
+	unsigned sent = 0;
+	unsigned received = 0;
+	uint8_t count;
+	uint32_t best;
+
+	g_EepromEmu_WriteTicks = TEST_EEPROM_WRITE;
+	g_EepromEmu_WaitHook = Test_eepromWait;
+	g_EepromEmu_Waits = 0;
+
+	Test_command(SERIALCMD_RESET, NULL, 0, SERIALCMD_OK, 1, &response);
+	Test_wait(100);
+	g_Test_MaxFeedGap = 0;
+	g_Test_MaxSlotGap = 0;
+
+	for (count = 0; count < TEST_LAP_BURST; count++)
+	{
+		Test_pcSend(SERIALCMD_LAP, NULL, 0);
+	}
+
+	for (count = 0; count < TEST_LAP_BURST; count++)
+	{
+		TEST_CHECK(Test_receive(&response) && (response.command == (SERIALCMD_LAP | SERIALCMD_RESPONSE_FLAG)));
+		TEST_CHECK(response.payload[0] == SERIALCMD_OK);
+	}
+
+	start = g_Test_Now;
+
+	while ((g_Test_Now - start < TEST_STREAM_TICKS) || (received < sent))
+	{
+		while ((g_Test_Now - start < TEST_STREAM_TICKS) && (sent - received < TEST_IN_FLIGHT))
+		{
+			Test_pcSend(SERIALCMD_LAP, NULL, 0);
+			sent++;
+		}
+
+		if (!Test_receive(&response))
+		{
+			TEST_CHECK(0);
+			break;
+		}
+
+		TEST_CHECK(response.command == (SERIALCMD_LAP | SERIALCMD_RESPONSE_FLAG));
+		received++;
+	}
+
+	Test_wait(2000);                 /* The queued laps are written in the EEPROM */
+
+	Test_stats(&count, &best);
+	TEST_CHECK(count == LAPSTAT_WINDOW_SIZE);
+
+	printf("  LAP stream : %u laps in %lu ms , longest watchdog feed gap %lu ms , display slot gap %lu ms ,"
+			" %lu EEPROM busy waits\n", TEST_LAP_BURST + received, (unsigned long)(TEST_STREAM_TICKS * TEST_TICK_US / 1000),
+			(unsigned long)(g_Test_MaxFeedGap * TEST_TICK_US / 1000),
+			(unsigned long)(g_Test_MaxSlotGap * TEST_TICK_US / 1000), g_EepromEmu_Waits);
+
+	TEST_CHECK(received > TEST_STREAM_TICKS / 50);
+	TEST_CHECK(g_Test_MaxFeedGap < TEST_WDT_TICKS / 4);
+	TEST_CHECK(g_Test_MaxSlotGap < 16);             /* No digit is lit for more than a few refresh slots */
+	TEST_CHECK(g_EepromEmu_Waits == 0);
+
+	g_EepromEmu_WriteTicks = 0;
+	g_EepromEmu_WaitHook = NULL;
+}
+
+/* Pipelined STATUS commands : All answered in order , command rate and the latency (Frame received --> executed) */
+static void Test_throughput(void)
+{
+	Test_FrameType response;
+	uint32_t start = g_Test_Now;
+	uint32_t startBytes = g_Pc_RxTotal;
+	uint32_t ticks;
+	unsigned sent = 0;
+	unsigned received = 0;
+	uint16_t latency;
+	uint16_t maxLatency = 0;
+
+	while (received < TEST_PIPELINED)
+	{
+		while ((sent < TEST_PIPELINED) && (sent - received < TEST_IN_FLIGHT))
+		{
+			Test_pcSend(SERIALCMD_STATUS, NULL, 0);
+			sent++;
+		}
+
+		if (!Test_receive(&response))
+		{
+			TEST_CHECK(0);
+			break;
+		}
+
+		TEST_CHECK(response.command == (SERIALCMD_STATUS | SERIALCMD_RESPONSE_FLAG));
+		latency = response.payload[5] | (response.payload[6] << 8);
+		TEST_CHECK(latency <= (response.payload[7] | (response.payload[8] << 8)));
+
+		if (latency > maxLatency)
+		{
+			maxLatency = latency;
+		}
+
+		received++;
+	}
+
+	ticks = g_Test_Now - start;
+
+	printf("  Loopback at 9600 baud : %lu commands/s , %lu response bytes/s , latency max %lu us\n",
+			(unsigned long)(received * 1000000ULL / (ticks * TEST_TICK_US)),
+			(unsigned long)((g_Pc_RxTotal - startBytes) * 1000000ULL / (ticks * TEST_TICK_US)),
+			(unsigned long)(maxLatency * TEST_TICK_US));
+
+	TEST_CHECK(maxLatency < 64);                    /* About two main loop passes */
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+int main(void)
+{
+	srand(33);
+	signal(SIGALRM, Test_blocked);
+	alarm(TEST_BLOCKED_SECONDS);
+
+	MCUCSR = (1 << PORF);
+	g_Stub_WdtResetHook = Test_mainLoopPass;
+	g_Stub_DelayHook = Test_refreshSlot;
+
+	getcontext(&g_Test_FirmwareContext);
+	g_Test_FirmwareContext.uc_stack.ss_sp = g_Test_FirmwareStack;
+	g_Test_FirmwareContext.uc_stack.ss_size = sizeof(g_Test_FirmwareStack);
+	g_Test_FirmwareContext.uc_link = NULL;
+	makecontext(&g_Test_FirmwareContext, Test_firmware, 0);
+
+	Test_wait(100);                  /* Startup */
+
+	Test_commands();
+	Test_laps();
+	Test_displayPages();
+	Test_resetButton();
+	Test_txFull();
+	Test_lapStream();
+	Test_throughput();
+
+	TEST_CHECK(Test_pcSent());
+
+	return TEST_RESULT("test_serial_command");
+}
+
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_spi.c
+ * Description: Host test of The Interrupt driven SPI Master : Byte order , SS/LOAD framing and the queue.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "spi.h"
+
+#define TEST_FRAMES   100000UL
+
+void SPI_STC_vect(void);
+
+/*******************************************************************************
+ *                                SPI Slave Model                              *
+ *******************************************************************************/
+
+static uint16_t g_Slave_Shift = 0;      /* Bytes shifted in since the last latch */
+static uint8_t g_Slave_Bytes = 0;
+
+/* Transfer of the byte in SPDR is complete (The slave shifts it in while SS is low)
+ * Return 1 with the latched frame after its second byte : The (ISR) drives SS high (Latch)
+ * and low again at once if another frame is queued , so SS must be high only when idle
+ */
+static uint8_t Test_transferComplete(uint16_t *frame)
+{
+	TEST_CHECK(BIT_IS_CLEAR(PORTB, PB4));
+
+	g_Slave_Shift = (g_Slave_Shift << 8) | SPDR;
+	g_Slave_Bytes++;
+
+	SPI_STC_vect();
+
+	if (g_Slave_Bytes < 2)
+	{
+		TEST_CHECK(BIT_IS_CLEAR(PORTB, PB4));
+		return 0;
+	}
+
+	TEST_CHECK((BIT_IS_SET(PORTB, PB4) != 0) == SPI_isIdle());
+
+	*frame = g_Slave_Shift;
+	g_Slave_Bytes = 0;
+
+	return 1;
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+int main(void)
+{
+	static uint16_t sent[TEST_FRAMES];
+	unsigned long queued = 0;
+	unsigned long received = 0;
+	uint16_t frame;
+	uint8_t accepted;
+
+	SPI_initMaster();
+
+	TEST_CHECK(SPCR == ((1 << SPIE) | (1 << SPE) | (1 << MSTR)));
+	TEST_CHECK((DDRB & 0xF0) == ((1 << PB4) | (1 << PB5) | (1 << PB7)));
+	TEST_CHECK(BIT_IS_SET(PORTB, PB4));
+	TEST_CHECK(SPI_isIdle());
+
+	/* One frame : MSB first , SS low for the two bytes then high */
+	TEST_CHECK(SPI_sendFrame(0x1234));
+	TEST_CHECK(!SPI_isIdle());
+	TEST_CHECK(SPDR == 0x12);
+
+	TEST_CHECK(!Test_transferComplete(&frame));
+	TEST_CHECK(SPDR == 0x34);
+
+	TEST_CHECK(Test_transferComplete(&frame) && (frame == 0x1234));
+	TEST_CHECK(SPI_isIdle());
+
+	/* Full queue : The frame being shifted out and SPI_QUEUE_SIZE - 1 waiting frames */
+	for (accepted = 0; SPI_sendFrame(0xA000 + accepted); accepted++)
+	{
+		sent[queued++] = 0xA000 + accepted;
+	}
+
+	TEST_CHECK(accepted == SPI_QUEUE_SIZE);
+
+	/* Random sending and transfers , all the accepted frames are latched once and in order */
+	srand(31);
+
+	while (received < TEST_FRAMES)
+	{
+		frame = (uint16_t)rand();
+
+		if ((queued < TEST_FRAMES) && (rand() % 2) && SPI_sendFrame(frame))
+		{
+			sent[queued++] = frame;
+		}
+
+		if (!SPI_isIdle() && Test_transferComplete(&frame))
+		{
+			TEST_CHECK(received < queued);
+			TEST_CHECK(frame == sent[received]);
+			received++;
+		}
+	}
+
+	TEST_CHECK(SPI_isIdle());
+
+	return TEST_RESULT("test_spi");
+}
@@ -0,0 +1,332 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: test_warm_restart.c
+ * Description: Host test of The Warm Restart : The whole firmware is reset at random points
+ *              (Between the main loop passes , inside the display refresh and in the middle of
+ *              a state save) and the restored time must continue from the last completed save.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+/* The firmware main() is built as StopWatch_main() (-Dmain=StopWatch_main) */
+#undef main
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "test.h"
+#include "avr_stub.h"
+#include "timer1_sim.h"
+#include "StopWatch.h"
+#include "External_Interrupts.h"
+#include <util/delay.h>
+#include <avr/wdt.h>
+
+/* Each boot runs in a child process so all the RAM starts again from its initial values ,
+ * only the .noinit variables (__noinit_start ... __noinit_end from noinit.ld) are carried to the next boot
+ */
+extern uint8_t __noinit_start[];
+extern uint8_t __noinit_end[];
+
+int StopWatch_main(void);
+void TIMER1_COMPA_vect(void);
+uint8_t __real_CRC8_update(uint8_t crc, uint8_t data);
+
+#define TEST_BOOTS             3000
+#define TEST_PERIOD_TICKS      978UL                     /* Timer1 ticks in one second (OCR1A + 1) */
+#define TEST_DAY_TICKS         (86400UL * TEST_PERIOD_TICKS)
+#define TEST_MAX_BOOT_TICKS    20000                     /* About 20 seconds */
+#define TEST_EARLY_RESET_TICKS 64                        /* About two main loop passes */
+#define TEST_SAVE_CRC_BYTES    16                        /* At least the CRC bytes of one saved copy */
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Result of one boot sent to the parent process (Times in Timer1 ticks since 00:00:00) */
+typedef struct
+{
+	int checks;
+	int failures;
+	uint32_t restored;        /* Time after the startup */
+	uint8_t restoredPaused;
+	uint32_t saves;           /* Completed state saves */
+	uint32_t saved;           /* Time of the last completed save */
+	uint8_t savedPaused;
+	uint32_t reset;           /* Time at the reset */
+
+}Test_BootResultType;
+
+/*******************************************************************************
+ *                         Boot (Child Process) Side                           *
+ *******************************************************************************/
+
+static jmp_buf g_Test_Reset;
+static Test_BootResultType g_Test_Result;
+static uint32_t g_Test_Expected;          /* Time counted by the test from the restored time */
+static uint32_t g_Test_Passes;            /* Main loop passes */
+static long g_Test_TicksToReset;          /* Ticks before the reset (Reset at an arbitrary point) */
+static uint32_t g_Test_SaveResetPass;     /* Pass whose state save is interrupted (0 --> None) */
+static uint8_t g_Test_CrcToReset = 0;     /* CRC bytes before the reset in the interrupted save */
+
+static void Test_reset(void)
+{
+	g_Test_Result.reset = g_Test_Expected;
+	longjmp(g_Test_Reset, 1);
+}
+
+/* Stop Watch time shown by the firmware (Seconds and the Timer1 count of the current second) */
+static uint32_t Test_readTime(void)
+{
+	uint8_t hour, min, sec;
+
+	StopWatch_getTime(&hour, &min, &sec);
+
+	return ((hour * 60UL + min) * 60UL + sec) * TEST_PERIOD_TICKS + TCNT1;
+}
+
+/* Run Timer1 for some ticks , the compare (ISR) is served when the interrupts are enabled */
+static void Test_run(uint8_t ticks)
+{
+	uint32_t before;
+
+	while (ticks--)
+	{
+		before = g_Timer1Sim_Ticks;
+		Timer1Sim_tick();
+
+		if (g_Timer1Sim_Ticks != before)
+		{
+			g_Test_Expected = (g_Test_Expected + 1) % TEST_DAY_TICKS;
+		}
+
+		if (BIT_IS_SET(SREG, I_BIT))
+		{
+			Timer1Sim_serveCompare(TIMER1_COMPA_vect);
+		}
+
+		if (--g_Test_TicksToReset == 0)
+		{
+			Test_reset();
+		}
+	}
+}
+
+/* Each 4ms slot of the display refresh */
+static void Test_refreshSlot(void)
+{
+	Test_run(4);
+}
+
+/* Start of each main loop pass (WDT_feed) , the previous pass ended with a completed state save */
+static void Test_mainLoopPass(void)
+{
+	uint32_t now;
+
+	if (BIT_IS_CLEAR(WDTCR, WDE))
+	{
+		return;                   /* First feed by WDT_Init() (The main loop is not started) */
+	}
+
+	now = Test_readTime();
+
+	if (g_Test_Passes == 0)
+	{
+		g_Test_Result.restored = now;
+		g_Test_Result.restoredPaused = StopWatch_isPaused();
+		g_Test_Expected = now;
+	}
+	else
+	{
+		TEST_CHECK(now == g_Test_Expected);    /* Each Timer1 tick is counted once */
+		g_Test_Result.saves++;
+	}
+
+	g_Test_Result.saved = now;
+	g_Test_Result.savedPaused = StopWatch_isPaused();
+
+	if (++g_Test_Passes == g_Test_SaveResetPass)
+	{
+		g_Test_CrcToReset = 1 + rand() % TEST_SAVE_CRC_BYTES;
+	}
+
+	/* PAUSE and RESUME buttons */
+	if (rand() % 64 == 0)
+	{
+		if (StopWatch_isPaused())
+		{
+			StopWatch_resume();
+		}
+		else
+		{
+			StopWatch_pause();
+		}
+	}
+
+	Test_run(rand() % 8);
+}
+
+/* State save is interrupted in the middle of its CRC (Its copy has the new state and an old CRC) */
+uint8_t __wrap_CRC8_update(uint8_t crc, uint8_t data)
+{
+	if (g_Test_CrcToReset && (--g_Test_CrcToReset == 0))
+	{
+		Test_reset();
+	}
+
+	return __real_CRC8_update(crc, data);
+}
+
+static void Test_boot(uint8_t resetCause, unsigned seed, int pipeFd)
+{
+	srand(seed);
+
+	memset(&g_Test_Result, 0, sizeof(g_Test_Result));
+	g_Test_Checks = 0;
+	g_Test_Failures = 0;
+	g_Test_Passes = 0;
+	/* A quarter of the boots are reset in their first passes (Before or during the first saves) */
+	g_Test_TicksToReset = 1 + rand() % ((rand() % 4 == 0) ? TEST_EARLY_RESET_TICKS : TEST_MAX_BOOT_TICKS);
+	g_Test_SaveResetPass = (rand() % 3 == 0) ? 1 + rand() % ((rand() % 2) ? 4 : 100) : 0;
+
+	MCUCSR = resetCause;
+	g_Stub_WdtResetHook = Test_mainLoopPass;
+	g_Stub_DelayHook = Test_refreshSlot;
+
+	if (setjmp(g_Test_Reset) == 0)
+	{
+		StopWatch_main();
+	}
+
+	g_Test_Result.checks = g_Test_Checks;
+	g_Test_Result.failures = g_Test_Failures;
+
+	if ((write(pipeFd, &g_Test_Result, sizeof(g_Test_Result)) != sizeof(g_Test_Result)) ||
+		(write(pipeFd, __noinit_start, __noinit_end - __noinit_start) != __noinit_end - __noinit_start))
+	{
+		_exit(1);
+	}
+
+	_exit(0);
+}
+
+/*******************************************************************************
+ *                                MAIN FUNCTION                                *
+ *******************************************************************************/
+
+/* Read all the bytes written by the boot */
+static int Test_read(int fd, void *buffer, size_t size)
+{
+	uint8_t *data = buffer;
+	ssize_t count;
+
+	while (size)
+	{
+		count = read(fd, data, size);
+
+		if (count <= 0)
+		{
+			return 0;
+		}
+
+		data += count;
+		size -= count;
+	}
+
+	return 1;
+}
+
+int main(void)
+{
+	static const uint8_t causes[] = {(1 << WDRF), (1 << WDRF), (1 << BORF), (1 << BORF),
+			                         (1 << PORF), (1 << EXTRF), (1 << PORF) | (1 << BORF)};
+	Test_BootResultType result;
+	uint8_t savedValid = 0;              /* A completed save exists since the last cold start */
+	uint32_t savedTime = 0;
+	uint8_t savedPaused = 0;
+	uint32_t warmBoots = 0;
+	uint32_t worstLoss = 0;
+	uint32_t loss;
+	uint8_t cause;
+	uint8_t warm;
+	size_t index;
+	int boot;
+	int fds[2];
+	pid_t pid;
+	int status;
+
+	srand(30);
+
+	for (boot = 0; boot < TEST_BOOTS; boot++)
+	{
+		cause = (boot == 0) ? (1 << PORF) : causes[rand() % sizeof(causes)];
+		warm = (cause == (1 << WDRF)) || (cause == (1 << BORF));
+
+		/* RAM content is random after the power-on */
+		if (cause & (1 << PORF))
+		{
+			for (index = 0; index < (size_t)(__noinit_end - __noinit_start); index++)
+			{
+				__noinit_start[index] = rand();
+			}
+		}
+
+		if (pipe(fds) != 0)
+		{
+			return 1;
+		}
+
+		pid = fork();
+
+		if (pid == 0)
+		{
+			close(fds[0]);
+			Test_boot(cause, rand(), fds[1]);
+		}
+
+		close(fds[1]);
+
+		TEST_CHECK(Test_read(fds[0], &result, sizeof(result)));
+		TEST_CHECK(Test_read(fds[0], __noinit_start, __noinit_end - __noinit_start));
+
+		close(fds[0]);
+		waitpid(pid, &status, 0);
+		TEST_CHECK(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+
+		g_Test_Checks += result.checks;
+		g_Test_Failures += result.failures;
+
+		if (warm && savedValid)
+		{
+			/* Continue from the last completed save (Timer1 count 977 is restarted at 976) */
+			loss = (savedTime + TEST_DAY_TICKS - result.restored) % TEST_DAY_TICKS;
+
+			TEST_CHECK(loss <= 1);
+			TEST_CHECK(result.restoredPaused == savedPaused);
+
+			worstLoss = (loss > worstLoss) ? loss : worstLoss;
+			warmBoots++;
+		}
+		else
+		{
+			/* Cold start (Power-on , External reset or no completed save since the last cold start) */
+			TEST_CHECK(result.restored == 0);
+			TEST_CHECK(result.restoredPaused == 0);
+			savedValid = 0;
+		}
+
+		if (result.saves)
+		{
+			savedValid = 1;
+			savedTime = result.saved;
+			savedPaused = result.savedPaused;
+		}
+	}
+
+	printf("  %u warm restarts of %d boots , worst time lost from the last save %u ticks\n",
+			(unsigned)warmBoots, TEST_BOOTS, (unsigned)worstLoss);
+
+	return TEST_RESULT("test_warm_restart");
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: timer1_sim.c
+ * Description: Timer1 CTC mode (TOP = OCR1A) model driving the stub registers.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "timer1_sim.h"
+#include "avr_stub.h"
+
+uint32_t g_Timer1Sim_Ticks = 0;
+
+void Timer1Sim_reset(void)
+{
+	TCNT1 = 0;
+	Stub_clearFlag(OCF1A);
+	Stub_clearFlag(ICF1);
+	g_Timer1Sim_Ticks = 0;
+}
+
+void Timer1Sim_tick(void)
+{
+	if ((TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10))) == 0)
+	{
+		return;               /* No clock source (Paused) */
+	}
+
+	/* OCF1A is set in the timer clock after the match , the same clock that clears the counter */
+	if (TCNT1 == OCR1A)
+	{
+		TCNT1 = 0;
+		Stub_setFlag(OCF1A);
+	}
+	else
+	{
+		TCNT1++;
+	}
+
+	g_Timer1Sim_Ticks++;
+}
+
+void Timer1Sim_serveCompare(void (*isr)(void))
+{
+	if (Stub_isFlagSet(OCF1A))
+	{
+		Stub_clearFlag(OCF1A);
+		isr();
+		Stub_syncTifr();
+	}
+}
+
+void Timer1Sim_capture(void)
+{
+	ICR1 = TCNT1;
+	Stub_setFlag(ICF1);
+}
+
+void Timer1Sim_serveCapture(void (*isr)(void))
+{
+	if (Stub_isFlagSet(ICF1))
+	{
+		Stub_clearFlag(ICF1);
+		isr();
+		Stub_syncTifr();
+	}
+}
@@ -0,0 +1,32 @@
+/******************************************************************************
+ * Module: Host Tests
+ * File Name: timer1_sim.h
+ * Description: Timer1 CTC mode (TOP = OCR1A) model driving the stub registers.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef TIMER1_SIM_H_
+#define TIMER1_SIM_H_
+
+#include <avr/io.h>
+
+/* Timer1 ticks counted since Timer1Sim_reset() (Reference of the 32-bit timestamps) */
+extern uint32_t g_Timer1Sim_Ticks;
+
+/* Clear the counter , the flags and the reference count */
+void Timer1Sim_reset(void);
+
+/* Advance Timer1 by one tick if its clock is ON (OCF1A is set when TCNT1 wraps from OCR1A to 0) */
+void Timer1Sim_tick(void);
+
+/* Call the Compare A (ISR) if OCF1A is set (The flag is cleared when the vector is executed) */
+void Timer1Sim_serveCompare(void (*isr)(void));
+
+/* Latch TCNT1 in ICR1 and set ICF1 as the ICP1 edge does */
+void Timer1Sim_capture(void);
+
+/* Call the Input Capture (ISR) if ICF1 is set (The flag is cleared when the vector is executed) */
+void Timer1Sim_serveCapture(void (*isr)(void));
+
+#endif /* TIMER1_SIM_H_ */
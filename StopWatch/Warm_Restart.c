@@ -0,0 +1,132 @@
+/******************************************************************************
+ * Module: Warm Restart
+ * File Name: Warm_Restart.c
+ * Description: Source file for The Stop Watch State Preservation (.noinit RAM) Module.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Warm_Restart.h"
+#include "crc8.h"
+#include <stddef.h>     /* offsetof() */
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Value of the valid byte of a complete copy */
+#define WARMRESTART_VALID_MARK   0xA5
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+	WarmRestart_StateType state;
+	uint8_t sequence;       /* Incremented each save to find the newest copy */
+	uint8_t crc;            /* CRC-8 of the state and sequence */
+	uint8_t valid;          /* WARMRESTART_VALID_MARK , Cleared first and written last by a save */
+
+}WarmRestart_CopyType;
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+/* Not cleared by the startup code , keeps its value across all the resets except the power-on
+ * (volatile : A reset may come between any two writes of a save , they must be done in order)
+ */
+static volatile WarmRestart_CopyType g_WarmRestart_Copies[2] __attribute__((section(".noinit")));
+
+static uint8_t g_WarmRestart_Sequence = 0;   /* Sequence of the last saved copy */
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* CRC-8 (Polynomial x^8 + x^2 + x + 1) of the copy bytes before its crc byte (No padding is included) */
+static uint8_t WarmRestart_crc(const volatile WarmRestart_CopyType *copy)
+{
+	const volatile uint8_t *data = (const volatile uint8_t *)copy;
+	uint8_t crc = CRC8_INITIAL_VALUE;
+	uint8_t count;
+
+	for (count = 0; count < offsetof(WarmRestart_CopyType, crc); count++)
+	{
+		crc = CRC8_update(crc, data[count]);
+	}
+
+	return crc;
+}
+
+/* Copy is complete and not corrupted */
+static uint8_t WarmRestart_isValid(const volatile WarmRestart_CopyType *copy)
+{
+	return (copy->valid == WARMRESTART_VALID_MARK) && (WarmRestart_crc(copy) == copy->crc);
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Get the state saved before the reset.
+ */
+uint8_t WarmRestart_restore(uint8_t resetCause, WarmRestart_StateType *state)
+{
+	uint8_t valid0 = WarmRestart_isValid(&g_WarmRestart_Copies[0]);
+	uint8_t valid1 = WarmRestart_isValid(&g_WarmRestart_Copies[1]);
+	uint8_t newest;
+
+	/* RAM content is random after power-on and the user asked for a new start by the external reset */
+	if (!(resetCause & (WDT_RESET_WATCHDOG | WDT_RESET_BROWN_OUT)) ||
+		(resetCause & (WDT_RESET_POWER_ON | WDT_RESET_EXTERNAL)) ||
+		(!valid0 && !valid1))
+	{
+		/* Copies of the old start must not be restored by a reset that comes before the first save */
+		g_WarmRestart_Copies[0].valid = 0;
+		g_WarmRestart_Copies[1].valid = 0;
+
+		return 0;
+	}
+
+	if (valid0 && valid1)
+	{
+		/* Newest copy is the one that follows the other in sequence */
+		newest = ((uint8_t)(g_WarmRestart_Copies[1].sequence - g_WarmRestart_Copies[0].sequence) == 1) ? 1 : 0;
+	}
+	else
+	{
+		newest = valid1;
+	}
+
+	*state = g_WarmRestart_Copies[newest].state;
+	g_WarmRestart_Sequence = g_WarmRestart_Copies[newest].sequence;
+
+	return 1;
+}
+
+
+/*
+ * Description :
+ * Save the state in the .noinit RAM.
+ */
+void WarmRestart_save(const WarmRestart_StateType *state)
+{
+	volatile WarmRestart_CopyType *copy;
+
+	g_WarmRestart_Sequence++;
+
+	copy = &g_WarmRestart_Copies[g_WarmRestart_Sequence & 1];
+
+	/* A copy with the new state and the old CRC could still match the CRC (1 in 256) ,
+	 * so it is not valid until all its bytes are written
+	 */
+	copy->valid = 0;
+	copy->state = *state;
+	copy->sequence = g_WarmRestart_Sequence;
+	copy->crc = WarmRestart_crc(copy);
+	copy->valid = WARMRESTART_VALID_MARK;
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Module: Warm Restart
+ * File Name: Warm_Restart.h
+ * Description: Header file for The Stop Watch State Preservation (.noinit RAM) Module.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef WARM_RESTART_H_
+#define WARM_RESTART_H_
+
+#include "Watchdog.h"
+#include "Elapsed_Time.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Stop Watch state kept in the RAM across the watchdog and brown-out resets */
+typedef struct
+{
+	Time_Type time;         /* Stop-Watch time */
+	uint8_t paused;         /* 1 --> Timer1 is stopped by PAUSE */
+	uint16_t timerCount;    /* Timer1 count (Fraction of the current second) */
+	uint32_t rtcWindowTicks; /* Learned Timer1 trim (RTC_getWindowTicks() , 0 if not trimmed) */
+
+}WarmRestart_StateType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Get the state saved before the reset.
+ * Return 1 if the reset is a watchdog or brown-out reset and a valid state (Complete copy and CRC is correct)
+ * is found , and 0 otherwise (Power-on/External reset or corrupted RAM --> Cold start).
+ * A cold start invalidates the saved copies.
+ */
+uint8_t WarmRestart_restore(uint8_t resetCause, WarmRestart_StateType *state);
+
+/*
+ * Description :
+ * Save the state in the .noinit RAM.
+ * Two copies are written alternately so a reset in the middle of a save keeps the previous one.
+ */
+void WarmRestart_save(const WarmRestart_StateType *state);
+
+
+#endif /* WARM_RESTART_H_ */
@@ -0,0 +1,53 @@
+/******************************************************************************
+ * Module: Watchdog
+ * File Name: Watchdog.c
+ * Description: Source file for The Eta32mini Watchdog Timer Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "Watchdog.h"
+#include <avr/wdt.h>      /* wdt_reset() --> WDR instruction */
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the cause(s) of the last reset (WDT_RESET_xxx flags) and clear them in MCUCSR.
+ */
+uint8_t WDT_getResetCause(void)
+{
+	uint8_t cause = MCUCSR & (WDT_RESET_POWER_ON | WDT_RESET_EXTERNAL | WDT_RESET_BROWN_OUT | WDT_RESET_WATCHDOG);
+
+	MCUCSR &= ~cause;       /* Clear the flags (by writing logic zero) so the next reset cause is not mixed */
+
+	return cause;
+}
+
+
+/*
+ * Description :
+ * Enable the Watchdog Timer with the required time-out period.
+ */
+void WDT_Init(WDT_TimeoutType timeout)
+{
+	WDT_feed();             /* Start the first period from zero */
+
+	/* Configure watchdog control register WDTCR:
+	 * 1. WDE=1 Watchdog Enable
+	 * 2. WDP2:0 Watchdog Prescaler (Time-out period)
+	 */
+	WDTCR = (1 << WDE) | (timeout & 0x07);
+}
+
+
+/*
+ * Description :
+ * Restart the Watchdog Timer count (Must be called periodically by the main loop).
+ */
+void WDT_feed(void)
+{
+	wdt_reset();
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Module: Watchdog
+ * File Name: Watchdog.h
+ * Description: Header file for The Eta32mini Watchdog Timer Driver.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef WATCHDOG_H_
+#define WATCHDOG_H_
+
+#include "gpio.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Reset cause flags (Same bits as MCUCSR) */
+#define WDT_RESET_POWER_ON      (1 << PORF)
+#define WDT_RESET_EXTERNAL      (1 << EXTRF)
+#define WDT_RESET_BROWN_OUT     (1 << BORF)
+#define WDT_RESET_WATCHDOG      (1 << WDRF)
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Watchdog time-out periods at VCC = 5V (Value of WDP2:0) */
+typedef enum
+{
+	WDT_16_MS, WDT_32_MS, WDT_65_MS, WDT_130_MS, WDT_260_MS, WDT_520_MS, WDT_1000_MS, WDT_2100_MS
+
+}WDT_TimeoutType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the cause(s) of the last reset (WDT_RESET_xxx flags) and clear them in MCUCSR.
+ * Must be called once at the start of main() before any other reset can happen.
+ */
+uint8_t WDT_getResetCause(void);
+
+/*
+ * Description :
+ * Enable the Watchdog Timer with the required time-out period.
+ * The MC is reset if WDT_feed() is not called within this period.
+ */
+void WDT_Init(WDT_TimeoutType timeout);
+
+/*
+ * Description :
+ * Restart the Watchdog Timer count (Must be called periodically by the main loop).
+ */
+void WDT_feed(void);
+
+
+#endif /* WATCHDOG_H_ */
@@ -0,0 +1,31 @@
+/******************************************************************************
+ * Module: CRC-8
+ * File Name: crc8.c
+ * Description: Source file for The CRC-8 (Polynomial x^8 + x^2 + x + 1) Calculation.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "crc8.h"
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the CRC after adding one more byte (Bitwise calculation , No table in RAM).
+ */
+uint8_t CRC8_update(uint8_t crc, uint8_t data)
+{
+	uint8_t bit;
+
+	crc ^= data;
+
+	for (bit = 0; bit < 8; bit++)
+	{
+		crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) : (crc << 1);
+	}
+
+	return crc;
+}
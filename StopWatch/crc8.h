@@ -0,0 +1,32 @@
+/******************************************************************************
+ * Module: CRC-8
+ * File Name: crc8.h
+ * Description: Header file for The CRC-8 (Polynomial x^8 + x^2 + x + 1) Calculation.
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef CRC8_H_
+#define CRC8_H_
+
+#include "gpio.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Initial value of the CRC before the first byte */
+#define CRC8_INITIAL_VALUE   0xFF
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Return the CRC after adding one more byte (Bitwise calculation , No table in RAM).
+ */
+uint8_t CRC8_update(uint8_t crc, uint8_t data);
+
+
+#endif /* CRC8_H_ */
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Module: SPI
+ * File Name: spi.c
+ * Description: Source file for The Eta32mini SPI Master Driver (Interrupt driven transmit).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "spi.h"
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+static volatile uint16_t g_SPI_Queue[SPI_QUEUE_SIZE];
+static volatile uint8_t g_SPI_Head = 0;
+static volatile uint8_t g_SPI_Tail = 0;
+
+static volatile uint8_t g_SPI_Busy = 0;          /* A frame is being shifted out */
+static volatile uint8_t g_SPI_LowByte = 0;       /* Second byte of the current frame */
+static volatile uint8_t g_SPI_LowPending = 0;    /* Second byte is not sent yet */
+
+/*******************************************************************************
+ *                           Private Functions                                 *
+ *******************************************************************************/
+
+/* Start shifting out the oldest queued frame (Called with the interrupts disabled) */
+static void SPI_startNextFrame(void)
+{
+	uint16_t frame = g_SPI_Queue[g_SPI_Tail];
+
+	g_SPI_Tail = (g_SPI_Tail + 1) & (SPI_QUEUE_SIZE - 1);
+
+	g_SPI_LowByte = (uint8_t)frame;
+	g_SPI_LowPending = 1;
+	g_SPI_Busy = 1;
+
+	CLEAR_BIT(PORTB,PB4);         /* SS/LOAD low during the frame */
+	SPDR = (uint8_t)(frame >> 8); /* Shift out the first byte */
+}
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enable the SPI as Master with the SPI Transfer Complete interrupt , SCK = F_CPU/4.
+ */
+void SPI_initMaster(void)
+{
+	GPIO_setPinDirection(PORTB_ID, PB4, PIN_OUTPUT);   /* SS   as O/P pin (Must be O/P in Master mode) */
+	GPIO_setPinDirection(PORTB_ID, PB5, PIN_OUTPUT);   /* MOSI as O/P pin */
+	GPIO_setPinDirection(PORTB_ID, PB6, PIN_INPUT);    /* MISO as I/P pin */
+	GPIO_setPinDirection(PORTB_ID, PB7, PIN_OUTPUT);   /* SCK  as O/P pin */
+
+	GPIO_writePin(PORTB_ID, PB4, LOGIC_HIGH);          /* No frame is selected */
+
+	/* Configure SPI control register SPCR:
+	 * 1. SPIE=1 SPI Transfer Complete Interrupt Enable
+	 * 2. SPE=1 SPI Enable , MSTR=1 Master mode , DORD=0 MSB first
+	 * 3. CPOL=0 CPHA=0 (Mode 0)
+	 * 4. SCK = F_CPU/4 SPR1=0 SPR0=0 SPI2X=0
+	 */
+	SPCR = (1 << SPIE) | (1 << SPE) | (1 << MSTR);
+	SPSR &= ~(1 << SPI2X);
+}
+
+
+/*
+ * Description :
+ * Queue a 16-bit frame (MSB first) for transmission.
+ */
+uint8_t SPI_sendFrame(uint16_t frame)
+{
+	uint8_t next = (g_SPI_Head + 1) & (SPI_QUEUE_SIZE - 1);
+	uint8_t sreg;
+
+	if (next == g_SPI_Tail)
+	{
+		return 0;                 /* Queue is full */
+	}
+
+	sreg = SREG;
+	CLEAR_BIT(SREG, I_BIT);       /* The (ISR) must not see a half written frame or miss the start */
+
+	g_SPI_Queue[g_SPI_Head] = frame;
+	g_SPI_Head = next;
+
+	if (!g_SPI_Busy)
+	{
+		SPI_startNextFrame();
+	}
+
+	SREG = sreg;
+
+	return 1;
+}
+
+
+/*
+ * Description :
+ * Return 1 if all the queued frames are transmitted and 0 otherwise.
+ */
+uint8_t SPI_isIdle(void)
+{
+	return !g_SPI_Busy;
+}
+
+
+/*******************************************************************************
+ *                          INTERRUPT SERVICE ROUTINES                         *
+ *******************************************************************************/
+
+/* SPI Transfer Complete (ISR) that shifts out the rest of the queued frames without the CPU */
+ISR(SPI_STC_vect)
+{
+	if (g_SPI_LowPending)
+	{
+		g_SPI_LowPending = 0;
+		SPDR = g_SPI_LowByte;         /* Shift out the second byte */
+		return;
+	}
+
+	SET_BIT(PORTB,PB4);               /* SS/LOAD rising edge latches the frame */
+
+	if (g_SPI_Tail != g_SPI_Head)
+	{
+		SPI_startNextFrame();
+	}
+	else
+	{
+		g_SPI_Busy = 0;
+	}
+}
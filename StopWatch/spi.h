@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Module: SPI
+ * File Name: spi.h
+ * Description: Header file for The Eta32mini SPI Master Driver (Interrupt driven transmit).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef SPI_H_
+#define SPI_H_
+
+#include "External_Interrupts.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Number of 16-bit frames that can wait for transmission (Must be a power of 2) */
+#define SPI_QUEUE_SIZE   16
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enable the SPI as Master (MOSI/PB5 , SCK/PB7 , SS/PB4 used as the frame latch (LOAD))
+ * with the SPI Transfer Complete interrupt , SCK = F_CPU/4.
+ */
+void SPI_initMaster(void);
+
+/*
+ * Description :
+ * Queue a 16-bit frame (MSB first) for transmission , SS is driven low while the two bytes
+ * are shifted out and high after them (Latch the frame in MAX7219 or 74HC595 chain).
+ * Return 1 if the frame is queued and 0 if the queue is full.
+ */
+uint8_t SPI_sendFrame(uint16_t frame);
+
+/*
+ * Description :
+ * Return 1 if all the queued frames are transmitted and 0 otherwise.
+ */
+uint8_t SPI_isIdle(void);
+
+
+#endif /* SPI_H_ */
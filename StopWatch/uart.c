@@ -0,0 +1,161 @@
+/******************************************************************************
+ * Module: UART
+ * File Name: uart.c
+ * Description: Source file for The Eta32mini UART Driver (Interrupt driven RX/TX ring buffers).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#include "uart.h"
+#include "Input_Capture.h"
+
+/*******************************************************************************
+ *                               Global Variables                              *
+ *******************************************************************************/
+
+static volatile uint8_t g_UART_RxBuffer[UART_RX_BUFFER_SIZE];
+static volatile uint16_t g_UART_RxTime[UART_RX_BUFFER_SIZE];   /* Timer1 timestamp (Low 16 bits) when each byte is received */
+static volatile uint8_t g_UART_RxHead = 0;
+static volatile uint8_t g_UART_RxTail = 0;
+
+static volatile uint8_t g_UART_TxBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint8_t g_UART_TxHead = 0;
+static volatile uint8_t g_UART_TxTail = 0;
+
+/*******************************************************************************
+ *                           Functions Definitions                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enable the UART : 8 data bits , No parity , 1 stop bit , Double speed (U2X).
+ */
+void UART_init(void)
+{
+	/* Baud rate register for the double speed mode : UBRR = (F_CPU / (8 * BAUD)) - 1 (Rounded) */
+	uint16_t ubrr = (uint16_t)(((F_CPU + (4UL * UART_BAUD_RATE)) / (8UL * UART_BAUD_RATE)) - 1);
+
+	UCSRA = (1 << U2X);
+
+	/* Configure UART control register UCSRC:
+	 * 1. URSEL=1 to write UCSRC (Shared address with UBRRH)
+	 * 2. UMSEL=0 Asynchronous , UPM1:0=00 No parity , USBS=0 1 stop bit
+	 * 3. UCSZ1:0=11 8 data bits
+	 */
+	UCSRC = (1 << URSEL) | (1 << UCSZ1) | (1 << UCSZ0);
+
+	UBRRH = (uint8_t)(ubrr >> 8);
+	UBRRL = (uint8_t)ubrr;
+
+	/* Configure UART control register UCSRB:
+	 * RXCIE=1 RX Complete Interrupt Enable , RXEN=1 TXEN=1
+	 * (UDRIE is enabled only while there are bytes to send)
+	 */
+	UCSRB = (1 << RXCIE) | (1 << RXEN) | (1 << TXEN);
+}
+
+
+/*
+ * Description :
+ * Return the number of received bytes waiting in the RX buffer.
+ */
+uint8_t UART_available(void)
+{
+	return (g_UART_RxHead - g_UART_RxTail) & (UART_RX_BUFFER_SIZE - 1);
+}
+
+
+/*
+ * Description :
+ * Return the received byte at the required offset from the oldest one without removing it.
+ */
+uint8_t UART_peek(uint8_t offset)
+{
+	return g_UART_RxBuffer[(g_UART_RxTail + offset) & (UART_RX_BUFFER_SIZE - 1)];
+}
+
+
+/*
+ * Description :
+ * Return the Timer1 timestamp (Low 16 bits) when the byte at the required offset is received.
+ */
+uint16_t UART_peekTime(uint8_t offset)
+{
+	return g_UART_RxTime[(g_UART_RxTail + offset) & (UART_RX_BUFFER_SIZE - 1)];
+}
+
+
+/*
+ * Description :
+ * Remove the required number of the oldest bytes from the RX buffer.
+ */
+void UART_discard(uint8_t count)
+{
+	if (count > UART_available())
+	{
+		count = UART_available();
+	}
+
+	g_UART_RxTail = (g_UART_RxTail + count) & (UART_RX_BUFFER_SIZE - 1);
+}
+
+
+/*
+ * Description :
+ * Return the number of free bytes in the TX buffer.
+ */
+uint8_t UART_txFree(void)
+{
+	return (UART_TX_BUFFER_SIZE - 1) - ((g_UART_TxHead - g_UART_TxTail) & (UART_TX_BUFFER_SIZE - 1));
+}
+
+
+/*
+ * Description :
+ * Queue a byte for transmission (Waits only if the TX buffer is full).
+ */
+void UART_sendByte(uint8_t data)
+{
+	uint8_t next = (g_UART_TxHead + 1) & (UART_TX_BUFFER_SIZE - 1);
+
+	while (next == g_UART_TxTail);   /* Wait until the (ISR) sends a byte */
+
+	g_UART_TxBuffer[g_UART_TxHead] = data;
+	g_UART_TxHead = next;
+
+	SET_BIT(UCSRB,UDRIE);            /* Start (or continue) the transmission */
+}
+
+
+/*******************************************************************************
+ *                          INTERRUPT SERVICE ROUTINES                         *
+ *******************************************************************************/
+
+/* UART RX Complete (ISR) that stores the received byte and its time in the RX buffer */
+ISR(USART_RXC_vect)
+{
+	uint8_t data = UDR;
+	uint8_t next = (g_UART_RxHead + 1) & (UART_RX_BUFFER_SIZE - 1);
+
+	/* Drop the byte if the buffer is full (The frame CRC rejects the broken frame) */
+	if (next != g_UART_RxTail)
+	{
+		g_UART_RxBuffer[g_UART_RxHead] = data;
+		g_UART_RxTime[g_UART_RxHead] = (uint16_t)ICU_getTimestamp();
+		g_UART_RxHead = next;
+	}
+}
+
+
+/* UART Data Register Empty (ISR) that sends the next queued byte */
+ISR(USART_UDRE_vect)
+{
+	if (g_UART_TxTail == g_UART_TxHead)
+	{
+		CLEAR_BIT(UCSRB,UDRIE);      /* Nothing to send */
+		return;
+	}
+
+	UDR = g_UART_TxBuffer[g_UART_TxTail];
+	g_UART_TxTail = (g_UART_TxTail + 1) & (UART_TX_BUFFER_SIZE - 1);
+}
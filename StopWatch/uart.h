@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Module: UART
+ * File Name: uart.h
+ * Description: Header file for The Eta32mini UART Driver (Interrupt driven RX/TX ring buffers).
+ * Author: Stop Watch contributors
+ * Created on: Oct 19, 2026
+ *******************************************************************************/
+
+#ifndef UART_H_
+#define UART_H_
+
+#include "External_Interrupts.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define UART_BAUD_RATE        9600
+
+/* Size of the RX and TX ring buffers (Must be a power of 2 , Max 128) */
+#define UART_RX_BUFFER_SIZE   64
+#define UART_TX_BUFFER_SIZE   64
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enable the UART (RXD/PD0 , TXD/PD1) : 8 data bits , No parity , 1 stop bit , Double speed (U2X).
+ * The received bytes are timestamped with the Timer1 timestamp (ICU_getTimestamp() , After Timer1_CTC_Init()).
+ */
+void UART_init(void);
+
+/*
+ * Description :
+ * Return the number of received bytes waiting in the RX buffer.
+ */
+uint8_t UART_available(void);
+
+/*
+ * Description :
+ * Return the received byte at the required offset from the oldest one without removing it
+ * (The frames are parsed in place , no copy to another buffer).
+ */
+uint8_t UART_peek(uint8_t offset);
+
+/*
+ * Description :
+ * Return the Timer1 timestamp (Low 16 bits , F_CPU/1024 ticks) when the byte at the required offset is received.
+ * The difference from the current timestamp is exact for a byte received less than 65535 ticks (67s) ago.
+ */
+uint16_t UART_peekTime(uint8_t offset);
+
+/*
+ * Description :
+ * Remove the required number of the oldest bytes from the RX buffer.
+ */
+void UART_discard(uint8_t count);
+
+/*
+ * Description :
+ * Return the number of free bytes in the TX buffer.
+ */
+uint8_t UART_txFree(void);
+
+/*
+ * Description :
+ * Queue a byte for transmission (Waits only if the TX buffer is full).
+ */
+void UART_sendByte(uint8_t data);
+
+
+#endif /* UART_H_ */